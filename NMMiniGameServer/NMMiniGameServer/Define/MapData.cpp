@@ -27,9 +27,34 @@ namespace Constant
     // Server
     Int32 TickTerm = 60; // 게임 틱 사이 시간, 쓰지 마십시오
     Int32 MaxUserCount = 3; // 전체 유저
+    Int32 ServerIoEngine = 1; // 0 : select, 1 : WSAPoll, 2 : Registered I/O
+    Int32 ServerIoThreadCount = 0; // WSAPoll 엔진의 송수신 전담 스레드 수, 0 이면 메인 스레드에서 처리
+    Int32 ServerAcceptBudgetPerTick = 256; // 한 틱에 최대로 받을 접속 수
+    Int32 ServerAllocationCheckRooms = 0; // ALLOCATION_TRACKING 빌드에서 0 보다 크면 봇 방을 돌려 정상 상태 틱의 할당을 검사하고 종료합니다
+    Int32 ServerAllocationCheckTicks = 600; // 검사하는 틱 수
+    Int32 ServerAllocationWarmupTicks = 180; // 검사 전에 버퍼가 자리잡도록 기다리는 틱 수
+    Int32 ServerCharacterKernel = 2; // 캐릭터 이동 적분 커널, 0 스칼라 1 SSE2 2 AVX2, CPU 가 지원하지 않으면 낮춥니다
+    Int32 ServerTcpNoDelay = 1; // 1 이면 Nagle 을 끄고 틱 끝에서 모아 보냅니다
+    Int32 ServerUdpEnabled = 0; // 1 이면 같은 포트의 UDP 로 매 틱 위치를 보냅니다
+    Int32 ServerMaxSessionCount = 4096; // 미리 잡아두는 세션 슬롯 수, 넘는 접속은 바로 끊습니다
+    Int32 ServerMaxRoomCount = 1024; // 재사용하는 방 슬롯 수, 다 차면 매칭을 다시 대기열로 돌립니다
+    Int32 ServerPreallocate = 0; // 1 이면 시작할 때 세션, 방, 송신 프레임을 최대 수만큼 미리 만들어 둡니다
+    Int32 ServerLargePages = 0; // 1 이면 미리 잡는 방 메모리를 큰 페이지로 시도합니다
+    Int32 ServerRoomArenaBytes = 32768; // 방마다 경기 중 컨테이너에 쓰는 첫 메모리 블록 크기
+    Int32 ServerRoomBenchTicks = 0; // 0 보다 크면 시작할 때 인원 수마다 봇 방을 이 틱 수만큼 돌려 초당 틱 수를 재고 끝냅니다
+    Int32 ServerRoomSpecialized = 1; // 1 이면 인원 수로 펼친 충돌, 왕 검사 함수를 씁니다
+    Int32 ServerSendBackpressureBytes = 4096; // 못 보낸 바이트가 이보다 많으면 위치 같은 상태 패킷은 보내지 않고 최신 것으로 덮어씁니다
+    Int32 ServerSendByteLimit = 65536; // 세션마다 못 보내고 쌓아둘 수 있는 바이트
+    Int32 ServerSlowClientTicks = 150; // 송신 한도를 이 틱 수 동안 계속 넘으면 끊습니다
+    Int32 ServerFrameScratchBytes = 65536; // 스레드마다 한 틱 동안 쓰는 임시 메모리 블록 크기
+    Int32 ServerKeyframeTickInterval = 60; // 바뀌지 않은 캐릭터도 위치를 다시 보내는 틱 간격
+    Int32 ServerReceiveBytesPerTick = 256; // 세션당 한 틱에 처리할 수신 바이트
+    Int32 ServerReceivePacketsPerTick = 8; // 세션당 한 틱에 처리할 수신 패킷 수
+    Int32 ServerReceiveBurstTicks = 4; // 쓰지 않은 수신 한도를 몇 틱까지 모아둘지
 
     Double GameFirstWaitSeconds = 1.5; // 게임 최초 대기 시간 (매칭 <-> 조작 가능)
     Double GameTotalTimeSeconds = 90; // 게임 전체 시간
+    Int32 GameRandomSeed = 1; // 고정 소수점 빌드에서 방마다 아이템 난수를 시작하는 값, 같은 값과 같은 입력이면 같은 경기가 됩니다
 
     // Map
     Double MapSize = 1450; // 맵 사이즈 / 현 기준 ( 언리얼 맵 1300 + 연출을 위한 50 )
@@ -109,6 +134,30 @@ enum class ETypeToken
 map< std::string, std::pair< ETypeToken, void* > > variableMaps = {
     // Server
     AddToken( ETypeToken::Digit, MaxUserCount ),
+    AddToken( ETypeToken::Digit, ServerIoEngine ),
+    AddToken( ETypeToken::Digit, ServerIoThreadCount ),
+    AddToken( ETypeToken::Digit, ServerAcceptBudgetPerTick ),
+    AddToken( ETypeToken::Digit, ServerAllocationCheckRooms ),
+    AddToken( ETypeToken::Digit, ServerAllocationCheckTicks ),
+    AddToken( ETypeToken::Digit, ServerAllocationWarmupTicks ),
+    AddToken( ETypeToken::Digit, ServerCharacterKernel ),
+    AddToken( ETypeToken::Digit, ServerTcpNoDelay ),
+    AddToken( ETypeToken::Digit, ServerUdpEnabled ),
+    AddToken( ETypeToken::Digit, ServerKeyframeTickInterval ),
+    AddToken( ETypeToken::Digit, ServerMaxSessionCount ),
+    AddToken( ETypeToken::Digit, ServerMaxRoomCount ),
+    AddToken( ETypeToken::Digit, ServerPreallocate ),
+    AddToken( ETypeToken::Digit, ServerLargePages ),
+    AddToken( ETypeToken::Digit, ServerRoomArenaBytes ),
+    AddToken( ETypeToken::Digit, ServerRoomBenchTicks ),
+    AddToken( ETypeToken::Digit, ServerRoomSpecialized ),
+    AddToken( ETypeToken::Digit, ServerSendBackpressureBytes ),
+    AddToken( ETypeToken::Digit, ServerSendByteLimit ),
+    AddToken( ETypeToken::Digit, ServerSlowClientTicks ),
+    AddToken( ETypeToken::Digit, ServerFrameScratchBytes ),
+    AddToken( ETypeToken::Digit, ServerReceiveBytesPerTick ),
+    AddToken( ETypeToken::Digit, ServerReceivePacketsPerTick ),
+    AddToken( ETypeToken::Digit, ServerReceiveBurstTicks ),
     // Map
     AddToken( ETypeToken::Float, MapSize ),
     AddToken( ETypeToken::Float, MapSpawnPointRatio ),
@@ -137,6 +186,7 @@ map< std::string, std::pair< ETypeToken, void* > > variableMaps = {
     AddToken( ETypeToken::Float, CharacterDieSeconds ),
     AddToken( ETypeToken::Float, GameFirstWaitSeconds ),
     AddToken( ETypeToken::Float, GameTotalTimeSeconds ),
+    AddToken( ETypeToken::Digit, GameRandomSeed ),
     AddToken( ETypeToken::Float, CharacterRushMinimumRecastSeconds ),
     AddToken( ETypeToken::Float, ScoreKillerJudgeTime ),
     // 새로 추가
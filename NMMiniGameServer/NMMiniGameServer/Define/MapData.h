@@ -23,9 +23,34 @@ namespace Constant
     // Server
     extern Int32 TickTerm;
     extern Int32 MaxUserCount;
+    extern Int32 ServerIoEngine;
+    extern Int32 ServerIoThreadCount;
+    extern Int32 ServerAcceptBudgetPerTick;
+    extern Int32 ServerAllocationCheckRooms;
+    extern Int32 ServerAllocationCheckTicks;
+    extern Int32 ServerAllocationWarmupTicks;
+    extern Int32 ServerCharacterKernel;
+    extern Int32 ServerTcpNoDelay;
+    extern Int32 ServerUdpEnabled;
+    extern Int32 ServerKeyframeTickInterval;
+    extern Int32 ServerMaxSessionCount;
+    extern Int32 ServerMaxRoomCount;
+    extern Int32 ServerPreallocate;
+    extern Int32 ServerLargePages;
+    extern Int32 ServerRoomArenaBytes;
+    extern Int32 ServerRoomBenchTicks;
+    extern Int32 ServerRoomSpecialized;
+    extern Int32 ServerSendBackpressureBytes;
+    extern Int32 ServerSendByteLimit;
+    extern Int32 ServerSlowClientTicks;
+    extern Int32 ServerFrameScratchBytes;
+    extern Int32 ServerReceiveBytesPerTick;
+    extern Int32 ServerReceivePacketsPerTick;
+    extern Int32 ServerReceiveBurstTicks;
 
     extern Double GameFirstWaitSeconds;
     extern Double GameTotalTimeSeconds;
+    extern Int32 GameRandomSeed;
 
     // Map
     extern Double MapSize;
@@ -12,6 +12,7 @@
 
 #pragma once
 #include "Define/DataTypes.h"
+#include <array>
 #define SERVER_HEADER(x) {sizeof(x), (EType::Server##x)}
 #define CLIENT_HEADER(x) {sizeof(x), (EType::Client##x)}
 #pragma pack(push, 1)
@@ -41,6 +42,10 @@ namespace Packet
         ServerItemRemove,
         ServerBuffStart,
         ServerBuffRemove,
+        ServerUdpToken,
+        ServerHello,
+        ServerWorldSnapshot,
+        ServerDeltaSnapshot,
 
         ClientTypeStart = 0x80,
         ClientRequestFindMatch,
@@ -48,8 +53,17 @@ namespace Packet
         ClientInput,
         ClientRequestReadyMatch,
         ClientRequestCancelReadyMatch,
+        ClientHello,
+        ClientSnapshotAck,
     };
 
+    // 1 : Header(Byte ), 2 : HeaderV2(UInt16 ) + WorldSnapshot, 3 : 2 + DeltaSnapshot/SnapshotAck
+    // Hello  ְޱ  ׻ 1 Դϴ.
+    constexpr Byte ProtocolVersion1 = 1;
+    constexpr Byte ProtocolVersion2 = 2;
+    constexpr Byte ProtocolVersion3 = 3;
+    constexpr Byte LatestProtocolVersion = ProtocolVersion3;
+
     enum class EInputState : Byte
     {
         None,
@@ -64,6 +78,29 @@ namespace Packet
         EType Type;
     };
 
+    struct HeaderV2
+    {
+        UInt16 Size;
+        EType Type;
+    };
+
+    inline UInt64 GetHeaderSize( Byte version )
+    {
+        return version >= ProtocolVersion2 ? sizeof( HeaderV2 ) : sizeof( Header );
+    }
+
+    inline UInt64 GetPacketSize( const Byte* packet, Byte version )
+    {
+        if ( version >= ProtocolVersion2 ) return reinterpret_cast< const HeaderV2* >( packet )->Size;
+        return reinterpret_cast< const Header* >( packet )->Size;
+    }
+
+    inline EType GetPacketType( const Byte* packet, Byte version )
+    {
+        if ( version >= ProtocolVersion2 ) return reinterpret_cast< const HeaderV2* >( packet )->Type;
+        return reinterpret_cast< const Header* >( packet )->Type;
+    }
+
 
     namespace Server
     {
@@ -203,6 +240,53 @@ namespace Packet
             Int32 mapIndex;
         };
 
+        // StartMatch  TCP  , Ŭ̾Ʈ  ū  UDP ͱ׷  ä ϴ.
+        struct UdpToken
+        {
+            Header header = SERVER_HEADER( UdpToken );
+            UInt32 token;
+            UInt16 port;
+        };
+
+        // Ŭ̾Ʈ Hello   ,  Ŷ  1 Դϴ.
+        struct Hello
+        {
+            Header header = SERVER_HEADER( Hello );
+            Byte version;
+        };
+
+        //  2 , ڿ WorldSnapshotEntity  entityCount  ̾ϴ.
+        // ġ Z  ׻ MapCharacterDefaultHeight,  Z  ׻ 0 ̶  ʽϴ.
+        struct WorldSnapshot
+        {
+            HeaderV2 header = { sizeof( WorldSnapshot ), EType::ServerWorldSnapshot };
+            UInt32 tick;
+            Byte entityCount;
+        };
+
+        struct WorldSnapshotEntity
+        {
+            Byte targetIndex;
+            Byte chracterState;
+            Single locationX;
+            Single locationY;
+            Single forwardX;
+            Single forwardY;
+        };
+
+        //  3 , ڿ  Ʈ ä Ʈ ̾ϴ.
+        // ƼƼ [ٲ 1] ٲ ʵ帶 [ٲ 1][] 
+        // state 4, locationX 16, locationY 16, angle 12, velocityX 16, velocityY 16 ƮԴϴ.
+        // ġ [-MapSize*2, MapSize*2],  [-pi, pi], ӵ [-CharacterMaxSpeed*2, CharacterMaxSpeed*2]  յ մϴ.
+        // baselineTick  0xFFFFFFFF ̸    ʵ尡  ֽϴ.
+        struct DeltaSnapshot
+        {
+            HeaderV2 header = { sizeof( DeltaSnapshot ), EType::ServerDeltaSnapshot };
+            UInt32 tick;
+            UInt32 baselineTick;
+            Byte entityCount;
+        };
+
     };
 
 
@@ -241,6 +325,76 @@ namespace Packet
             EInputState right;
             EInputState rush;
         };
+
+        //    1  ϴ,  ʴ Ŭ̾Ʈ   1 Դϴ.
+        struct Hello
+        {
+            Header header = CLIENT_HEADER( Hello );
+            Byte version;
+        };
+
+        //  3,   DeltaSnapshot  tick  ˸ϴ.
+        struct SnapshotAck
+        {
+            Header header = CLIENT_HEADER( SnapshotAck );
+            UInt32 tick;
+        };
+    };
+
+
+    // Ŭ̾Ʈ Ŷ   1 ũ, 0 ̸    Դϴ.
+    using PacketSizeTable = std::array< UInt16, 256 >;
+
+    template< typename T >
+    constexpr void RegisterPacketSize( PacketSizeTable& table )
+    {
+        table[ static_cast< Byte >( T{}.header.Type ) ] = sizeof( T );
+    }
+
+    constexpr PacketSizeTable MakeClientPacketSizeTable()
+    {
+        PacketSizeTable table{};
+        RegisterPacketSize< Client::RequestFindMatch >( table );
+        RegisterPacketSize< Client::RequestCancelMatch >( table );
+        RegisterPacketSize< Client::RequestReadyMatch >( table );
+        RegisterPacketSize< Client::RequestCancelReadyMatch >( table );
+        RegisterPacketSize< Client::Input >( table );
+        RegisterPacketSize< Client::Hello >( table );
+        RegisterPacketSize< Client::SnapshotAck >( table );
+        return table;
+    }
+
+    constexpr PacketSizeTable ClientPacketSizes = MakeClientPacketSizeTable();
+
+    //  ũ ̸ ݿ   ũ, 0 ̸    Դϴ.
+    inline UInt64 GetClientFrameSize( EType type, Byte version )
+    {
+        UInt64 size = ClientPacketSizes[ static_cast< Byte >( type ) ];
+        if ( size == 0 ) return 0;
+        return size - sizeof( Header ) + GetHeaderSize( version );
+    }
+
+    //   ִ Ŭ̾Ʈ    ū   2 ũԴϴ.
+    constexpr UInt64 GetMaxClientFrameSize()
+    {
+        UInt64 maxSize = 0;
+        for ( size_t i = 0; i < ClientPacketSizes.size(); i++ )
+        {
+            if ( ClientPacketSizes[ i ] > maxSize ) maxSize = ClientPacketSizes[ i ];
+        }
+        return maxSize - sizeof( Header ) + sizeof( HeaderV2 );
+    }
+
+
+    namespace Udp
+    {
+        //  UDP ͱ׷ պκ,  -> Ŭ̾Ʈ ڿ ObjectLocation  ̾ϴ.
+        // Ŭ̾Ʈ   ͺ  sequence  ϴ.
+        struct DatagramHeader
+        {
+            UInt32 token;
+            UInt32 sequence;
+        };
     };
 };
 
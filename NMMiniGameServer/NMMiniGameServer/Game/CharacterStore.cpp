@@ -0,0 +1,456 @@
+﻿// =================================================================================================
+//  @file CharacterStore.cpp
+// 
+//  @brief 방 캐릭터의 위치, 속도, 방향 같은 값을 필드별 배열로 모아 한 번에 적분합니다.
+//  
+//  @date 2026/10/17
+// 
+//  Copyright 2026 2022 Netmarble Neo, Inc. All Rights Reserved.
+// =================================================================================================
+
+
+#include "Game/CharacterStore.h"
+#include "Define/MapData.h"
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <intrin.h>
+#include <iostream>
+#include <random>
+
+
+namespace
+{
+    Game::ECharacterKernel selectedKernel = Game::ECharacterKernel::Scalar;
+
+    Game::ECharacterKernel GetSupportedKernel()
+    {
+        // AVX2 는 CPU 와 함께 OS 가 YMM 레지스터를 저장해 주는지도 확인해야 합니다.
+        Int32 info[ 4 ] = {};
+        __cpuid( info, 0 );
+        Int32 maxLeaf = info[ 0 ];
+        __cpuid( info, 1 );
+        Bool hasOsXsave = ( info[ 2 ] & ( 1 << 27 ) ) != 0;
+        Bool hasAvx = ( info[ 2 ] & ( 1 << 28 ) ) != 0;
+        if ( maxLeaf < 7 || !hasOsXsave || !hasAvx ) return Game::ECharacterKernel::Sse2;
+        if ( ( _xgetbv( 0 ) & 0x6 ) != 0x6 ) return Game::ECharacterKernel::Sse2;
+        __cpuidex( info, 7, 0 );
+        Bool hasAvx2 = ( info[ 1 ] & ( 1 << 5 ) ) != 0;
+        return hasAvx2 ? Game::ECharacterKernel::Avx2 : Game::ECharacterKernel::Sse2;
+    }
+
+
+    // 캐릭터 하나씩, 옛 PlayerCharacter::Update 를 그대로 풀어 쓴 것입니다.
+    // 상수도 NumTy 로 바꿔 두어서 Single 일 때 중간 계산이 Double 로 올라가지 않고, Fixed 일 때 정수로만 계산합니다.
+    template < typename NumTy >
+    void IntegrateScalar( NumTy* fields, Int32 count, Int32 begin, NumTy deltaTime, NumTy friction )
+    {
+        using Store = Game::CharacterStore;
+        const NumTy zero = NumTy( 0 );
+        const NumTy minusOne = NumTy( -1 );
+        const NumTy two = NumTy( 2 );
+        NumTy* lx = fields + Store::LocationX * count;
+        NumTy* ly = fields + Store::LocationY * count;
+        NumTy* sx = fields + Store::SpeedX * count;
+        NumTy* sy = fields + Store::SpeedY * count;
+        const NumTy* fx = fields + Store::ForwardX * count;
+        const NumTy* fy = fields + Store::ForwardY * count;
+        const NumTy* moveSpeed = fields + Store::MoveSpeed * count;
+        const NumTy* moveFlag = fields + Store::MoveFlag * count;
+        for ( Int32 i = begin; i < count; i++ )
+        {
+            NumTy move = moveFlag[ i ] != zero ? moveSpeed[ i ] : zero;
+            lx[ i ] = lx[ i ] + ( sx[ i ] + fx[ i ] * move ) * deltaTime;
+            ly[ i ] = ly[ i ] + ( sy[ i ] + fy[ i ] * move ) * deltaTime;
+            if constexpr ( std::is_floating_point_v< NumTy > ) assert( !std::isnan( lx[ i ] ) && !std::isnan( ly[ i ] ) );
+            // 마찰력
+            if ( sx[ i ] == zero && sy[ i ] == zero ) continue;
+            NumTy speedSqr = sx[ i ] * sx[ i ] + sy[ i ] * sy[ i ];
+            NumTy length;
+            if constexpr ( std::is_floating_point_v< NumTy > ) length = std::sqrt( speedSqr );
+            else length = Game::Fixed::Sqrt( speedSqr );
+            NumTy nx = length == zero ? zero : sx[ i ] / length;
+            NumTy ny = length == zero ? zero : sy[ i ] / length;
+            NumTy frictionX = nx * minusOne * friction * deltaTime * two;
+            NumTy frictionY = ny * minusOne * friction * deltaTime * two;
+            NumTy frictionSqr = frictionX * frictionX + frictionY * frictionY;
+            if ( speedSqr < frictionSqr )
+            {
+                sx[ i ] = zero;
+                sy[ i ] = zero;
+            }
+            else
+            {
+                sx[ i ] = sx[ i ] + frictionX;
+                sy[ i ] = sy[ i ] + frictionY;
+            }
+        }
+    }
+
+
+    // 명령어 집합과 성분 타입마다 하나씩, 벡터 커널이 쓰는 연산만 감쌉니다.
+    struct Sse2Double
+    {
+        using NumType = Double;
+        using Register = __m128d;
+        static constexpr Int32 Width = 2;
+        static Register Load( const NumType* p ) { return _mm_loadu_pd( p ); }
+        static void Store( NumType* p, Register a ) { _mm_storeu_pd( p, a ); }
+        static Register Set( NumType value ) { return _mm_set1_pd( value ); }
+        static Register AllOnes() { return _mm_castsi128_pd( _mm_set1_epi64x( -1 ) ); }
+        static Register Add( Register a, Register b ) { return _mm_add_pd( a, b ); }
+        static Register Mul( Register a, Register b ) { return _mm_mul_pd( a, b ); }
+        static Register Div( Register a, Register b ) { return _mm_div_pd( a, b ); }
+        static Register Sqrt( Register a ) { return _mm_sqrt_pd( a ); }
+        static Register And( Register a, Register b ) { return _mm_and_pd( a, b ); }
+        static Register AndNot( Register a, Register b ) { return _mm_andnot_pd( a, b ); }
+        static Register Equal( Register a, Register b ) { return _mm_cmpeq_pd( a, b ); }
+        static Register NotEqual( Register a, Register b ) { return _mm_cmpneq_pd( a, b ); }
+        static Register Less( Register a, Register b ) { return _mm_cmplt_pd( a, b ); }
+        static Register Select( Register mask, Register a, Register b ) { return _mm_or_pd( _mm_and_pd( mask, a ), _mm_andnot_pd( mask, b ) ); }
+    };
+
+    struct Sse2Single
+    {
+        using NumType = Single;
+        using Register = __m128;
+        static constexpr Int32 Width = 4;
+        static Register Load( const NumType* p ) { return _mm_loadu_ps( p ); }
+        static void Store( NumType* p, Register a ) { _mm_storeu_ps( p, a ); }
+        static Register Set( NumType value ) { return _mm_set1_ps( value ); }
+        static Register AllOnes() { return _mm_castsi128_ps( _mm_set1_epi32( -1 ) ); }
+        static Register Add( Register a, Register b ) { return _mm_add_ps( a, b ); }
+        static Register Mul( Register a, Register b ) { return _mm_mul_ps( a, b ); }
+        static Register Div( Register a, Register b ) { return _mm_div_ps( a, b ); }
+        static Register Sqrt( Register a ) { return _mm_sqrt_ps( a ); }
+        static Register And( Register a, Register b ) { return _mm_and_ps( a, b ); }
+        static Register AndNot( Register a, Register b ) { return _mm_andnot_ps( a, b ); }
+        static Register Equal( Register a, Register b ) { return _mm_cmpeq_ps( a, b ); }
+        static Register NotEqual( Register a, Register b ) { return _mm_cmpneq_ps( a, b ); }
+        static Register Less( Register a, Register b ) { return _mm_cmplt_ps( a, b ); }
+        static Register Select( Register mask, Register a, Register b ) { return _mm_or_ps( _mm_and_ps( mask, a ), _mm_andnot_ps( mask, b ) ); }
+    };
+
+    struct Avx2Double
+    {
+        using NumType = Double;
+        using Register = __m256d;
+        static constexpr Int32 Width = 4;
+        static Register Load( const NumType* p ) { return _mm256_loadu_pd( p ); }
+        static void Store( NumType* p, Register a ) { _mm256_storeu_pd( p, a ); }
+        static Register Set( NumType value ) { return _mm256_set1_pd( value ); }
+        static Register AllOnes() { return _mm256_castsi256_pd( _mm256_set1_epi64x( -1 ) ); }
+        static Register Add( Register a, Register b ) { return _mm256_add_pd( a, b ); }
+        static Register Mul( Register a, Register b ) { return _mm256_mul_pd( a, b ); }
+        static Register Div( Register a, Register b ) { return _mm256_div_pd( a, b ); }
+        static Register Sqrt( Register a ) { return _mm256_sqrt_pd( a ); }
+        static Register And( Register a, Register b ) { return _mm256_and_pd( a, b ); }
+        static Register AndNot( Register a, Register b ) { return _mm256_andnot_pd( a, b ); }
+        static Register Equal( Register a, Register b ) { return _mm256_cmp_pd( a, b, _CMP_EQ_OQ ); }
+        static Register NotEqual( Register a, Register b ) { return _mm256_cmp_pd( a, b, _CMP_NEQ_UQ ); }
+        static Register Less( Register a, Register b ) { return _mm256_cmp_pd( a, b, _CMP_LT_OQ ); }
+        static Register Select( Register mask, Register a, Register b ) { return _mm256_blendv_pd( b, a, mask ); }
+    };
+
+    struct Avx2Single
+    {
+        using NumType = Single;
+        using Register = __m256;
+        static constexpr Int32 Width = 8;
+        static Register Load( const NumType* p ) { return _mm256_loadu_ps( p ); }
+        static void Store( NumType* p, Register a ) { _mm256_storeu_ps( p, a ); }
+        static Register Set( NumType value ) { return _mm256_set1_ps( value ); }
+        static Register AllOnes() { return _mm256_castsi256_ps( _mm256_set1_epi32( -1 ) ); }
+        static Register Add( Register a, Register b ) { return _mm256_add_ps( a, b ); }
+        static Register Mul( Register a, Register b ) { return _mm256_mul_ps( a, b ); }
+        static Register Div( Register a, Register b ) { return _mm256_div_ps( a, b ); }
+        static Register Sqrt( Register a ) { return _mm256_sqrt_ps( a ); }
+        static Register And( Register a, Register b ) { return _mm256_and_ps( a, b ); }
+        static Register AndNot( Register a, Register b ) { return _mm256_andnot_ps( a, b ); }
+        static Register Equal( Register a, Register b ) { return _mm256_cmp_ps( a, b, _CMP_EQ_OQ ); }
+        static Register NotEqual( Register a, Register b ) { return _mm256_cmp_ps( a, b, _CMP_NEQ_UQ ); }
+        static Register Less( Register a, Register b ) { return _mm256_cmp_ps( a, b, _CMP_LT_OQ ); }
+        static Register Select( Register mask, Register a, Register b ) { return _mm256_blendv_ps( b, a, mask ); }
+    };
+
+
+    // Lane::Width 캐릭터씩, 분기는 마스크로 바꿉니다. 처리한 캐릭터 수를 돌려줍니다.
+    template < typename Lane >
+    Int32 IntegrateLanes( typename Lane::NumType* fields, Int32 count, typename Lane::NumType deltaTime, typename Lane::NumType friction )
+    {
+        using Store = Game::CharacterStore;
+        using NumType = typename Lane::NumType;
+        using Register = typename Lane::Register;
+        const Register zero = Lane::Set( 0 );
+        const Register minusOne = Lane::Set( -1 );
+        const Register two = Lane::Set( 2 );
+        const Register dt = Lane::Set( deltaTime );
+        const Register fr = Lane::Set( friction );
+        Int32 i = 0;
+        for ( ; i + Lane::Width <= count; i += Lane::Width )
+        {
+            NumType* l[ 2 ] = { fields + Store::LocationX * count + i, fields + Store::LocationY * count + i };
+            NumType* s[ 2 ] = { fields + Store::SpeedX * count + i, fields + Store::SpeedY * count + i };
+            const NumType* f[ 2 ] = { fields + Store::ForwardX * count + i, fields + Store::ForwardY * count + i };
+            Register isMoving = Lane::NotEqual( Lane::Load( fields + Store::MoveFlag * count + i ), zero );
+            Register move = Lane::And( Lane::Load( fields + Store::MoveSpeed * count + i ), isMoving );
+            Register speed[ 2 ];
+            Register isZero = Lane::AllOnes();
+            Register speedSqr = zero;
+            for ( Int32 axis = 0; axis < 2; axis++ )
+            {
+                speed[ axis ] = Lane::Load( s[ axis ] );
+                Register finalSpeed = Lane::Add( speed[ axis ], Lane::Mul( Lane::Load( f[ axis ] ), move ) );
+                Lane::Store( l[ axis ], Lane::Add( Lane::Load( l[ axis ] ), Lane::Mul( finalSpeed, dt ) ) );
+                isZero = Lane::And( isZero, Lane::Equal( speed[ axis ], zero ) );
+                Register square = Lane::Mul( speed[ axis ], speed[ axis ] );
+                speedSqr = axis == 0 ? square : Lane::Add( speedSqr, square );
+            }
+            Register length = Lane::Sqrt( speedSqr );
+            Register isLengthZero = Lane::Equal( length, zero );
+            Register frictionVector[ 2 ];
+            Register frictionSqr = zero;
+            for ( Int32 axis = 0; axis < 2; axis++ )
+            {
+                Register normal = Lane::AndNot( isLengthZero, Lane::Div( speed[ axis ], length ) );
+                frictionVector[ axis ] = Lane::Mul( Lane::Mul( Lane::Mul( Lane::Mul( normal, minusOne ), fr ), dt ), two );
+                Register square = Lane::Mul( frictionVector[ axis ], frictionVector[ axis ] );
+                frictionSqr = axis == 0 ? square : Lane::Add( frictionSqr, square );
+            }
+            Register isStopped = Lane::Less( speedSqr, frictionSqr );
+            for ( Int32 axis = 0; axis < 2; axis++ )
+            {
+                Register slowed = Lane::AndNot( isStopped, Lane::Add( speed[ axis ], frictionVector[ axis ] ) );
+                Lane::Store( s[ axis ], Lane::Select( isZero, speed[ axis ], slowed ) );
+            }
+        }
+        return i;
+    }
+
+
+    template < typename NumTy >
+    struct KernelLanes;
+
+    template <>
+    struct KernelLanes< Double >
+    {
+        using Sse2 = Sse2Double;
+        using Avx2 = Avx2Double;
+    };
+
+    template <>
+    struct KernelLanes< Single >
+    {
+        using Sse2 = Sse2Single;
+        using Avx2 = Avx2Single;
+    };
+
+
+    // Fixed 는 스칼라 커널만 씁니다.
+    template < typename NumTy >
+    void Integrate( Game::ECharacterKernel kernel, NumTy* fields, Int32 count, NumTy deltaTime, NumTy friction )
+    {
+        Int32 done = 0;
+        if constexpr ( std::is_floating_point_v< NumTy > )
+        {
+            if ( kernel == Game::ECharacterKernel::Avx2 ) done = IntegrateLanes< typename KernelLanes< NumTy >::Avx2 >( fields, count, deltaTime, friction );
+            else if ( kernel == Game::ECharacterKernel::Sse2 ) done = IntegrateLanes< typename KernelLanes< NumTy >::Sse2 >( fields, count, deltaTime, friction );
+        }
+        IntegrateScalar( fields, count, done, deltaTime, friction );
+    }
+
+
+    template < typename NumTy >
+    Game::ECharacterKernel GetSupportedKernelOf()
+    {
+        return std::is_floating_point_v< NumTy > ? GetSupportedKernel() : Game::ECharacterKernel::Scalar;
+    }
+
+
+    // 검사 시나리오는 설정 파일과 상관없이 기본 설정 값으로 돌립니다.
+    constexpr Int32 ScenarioCharacterCount = 23; // SIMD 폭으로 나누어떨어지지 않게 해서 스칼라 꼬리도 검사합니다
+    constexpr Int32 ScenarioStepCount = 240;
+    constexpr Double ScenarioDeltaTime = 1.0 / 60.0;
+    constexpr Double ScenarioMapSize = 1450.0;
+    constexpr Double ScenarioMaxSpeed = 2000.0;
+    constexpr Double ScenarioMoveSpeed = 600.0;
+    constexpr Double ScenarioFriction = 1000.0;
+    // Fixed 로 시나리오를 돌린 결과의 FNV-1a 해시입니다. 정수 연산만 쓰므로 어느 빌드에서도 같아야 합니다.
+    constexpr UInt64 FixedScenarioChecksum = 0xccb22da78af92e27ULL;
+
+
+    template < typename NumTy >
+    const char* GetNumTypeName()
+    {
+        if constexpr ( std::is_same_v< NumTy, Double > ) return "Double";
+        else if constexpr ( std::is_same_v< NumTy, Single > ) return "Single";
+        else return "Fixed";
+    }
+
+
+    std::vector< Double > MakeScenario()
+    {
+        // 분포 클래스는 표준 라이브러리마다 결과가 달라서 mt19937 출력을 직접 [ -1, 1 ] 로 바꿉니다.
+        // 멈춤, 정지 직전 속도, 아주 작은 속도처럼 분기가 갈리는 값을 섞습니다.
+        using Store = Game::CharacterStore;
+        constexpr Int32 count = ScenarioCharacterCount;
+        std::mt19937 random( 20261017 );
+        auto unit = [&random]() { return static_cast< Double >( random() ) / 4294967295.0 * 2.0 - 1.0; };
+        std::vector< Double > source( static_cast< size_t >( Store::FieldCount ) * count );
+        for ( Int32 i = 0; i < count; i++ )
+        {
+            Double forwardX = unit();
+            Double forwardY = unit();
+            Double length = sqrt( forwardX * forwardX + forwardY * forwardY );
+            source[ Store::LocationX * count + i ] = unit() * ScenarioMapSize * 0.5;
+            source[ Store::LocationY * count + i ] = unit() * ScenarioMapSize * 0.5;
+            source[ Store::SpeedX * count + i ] = i % 5 == 0 ? 0.0 : unit() * ScenarioMaxSpeed;
+            source[ Store::SpeedY * count + i ] = i % 5 == 0 ? 0.0 : unit() * ScenarioMaxSpeed;
+            if ( i % 7 == 0 ) source[ Store::SpeedX * count + i ] = ScenarioFriction * ScenarioDeltaTime;
+            if ( i % 11 == 0 ) source[ Store::SpeedY * count + i ] = 1e-30;
+            source[ Store::ForwardX * count + i ] = length == 0.0 ? 0.0 : forwardX / length;
+            source[ Store::ForwardY * count + i ] = length == 0.0 ? 1.0 : forwardY / length;
+            source[ Store::MoveSpeed * count + i ] = ScenarioMoveSpeed;
+            source[ Store::MoveFlag * count + i ] = i % 3 == 0 ? 0.0 : 1.0;
+        }
+        return source;
+    }
+
+
+    // 틱마다 적분한 뒤 캐릭터마다 다른 각도로 방향을 돌려서 회전 계산까지 함께 검사합니다.
+    template < typename NumTy >
+    std::vector< NumTy > RunScenario( Game::ECharacterKernel kernel, const std::vector< Double >& source, Double scenarioDeltaTime )
+    {
+        using Store = Game::CharacterStore;
+        constexpr Int32 count = ScenarioCharacterCount;
+        std::vector< NumTy > fields;
+        fields.reserve( source.size() );
+        for ( Double value : source ) fields.push_back( NumTy( value ) );
+        NumTy deltaTime = NumTy( scenarioDeltaTime );
+        NumTy friction = NumTy( ScenarioFriction );
+        for ( Int32 step = 0; step < ScenarioStepCount; step++ )
+        {
+            Integrate( kernel, fields.data(), count, deltaTime, friction );
+            for ( Int32 i = 0; i < count; i++ )
+            {
+                NumTy& forwardX = fields[ Store::ForwardX * count + i ];
+                NumTy& forwardY = fields[ Store::ForwardY * count + i ];
+                Game::VectorT< NumTy, 2 > forward = Game::VectorT< NumTy, 2 >( forwardX, forwardY ).Rotated2D( ( i % 4 + 1 ) * 1.5 );
+                forwardX = forward.x;
+                forwardY = forward.y;
+            }
+        }
+        return fields;
+    }
+
+
+    template < typename NumTy >
+    UInt64 GetChecksum( const std::vector< NumTy >& fields )
+    {
+        const Byte* bytes = reinterpret_cast< const Byte* >( fields.data() );
+        UInt64 hash = 14695981039346656037ULL;
+        for ( size_t i = 0; i < fields.size() * sizeof( NumTy ); i++ )
+        {
+            hash ^= bytes[ i ];
+            hash *= 1099511628211ULL;
+        }
+        return hash;
+    }
+}
+
+
+Game::CharacterStore::CharacterStore( Int32 count, std::pmr::memory_resource* resource )
+    : count( count ), fields( static_cast< size_t >( FieldCount ) * count, NumType(), resource )
+{
+}
+
+
+Int32 Game::CharacterStore::GetCount() const
+{
+    return count;
+}
+
+
+void Game::CharacterStore::Integrate( Double deltaTime )
+{
+    ::Integrate( selectedKernel, fields.data(), count, NumType( deltaTime ), NumType( Constant::CharacterFriction ) );
+}
+
+
+void Game::CharacterStore::SelectKernel( ECharacterKernel requested )
+{
+    // 요청한 커널을 CPU 가 지원하지 않으면 지원하는 것 중 가장 넓은 것을 씁니다.
+    ECharacterKernel supported = GetSupportedKernelOf< NumType >();
+    selectedKernel = static_cast< Int32 >( requested ) > static_cast< Int32 >( supported ) ? supported : requested;
+    std::cout << "Character kernel : " << ToString( selectedKernel ) << " " << GetNumTypeName< NumType >() << "\n";
+}
+
+
+Game::ECharacterKernel Game::CharacterStore::GetKernel()
+{
+    return selectedKernel;
+}
+
+
+Bool Game::CharacterStore::VerifyKernels()
+{
+    // 1/60 초는 Fixed 로 정확히 나타낼 수 없으므로, Double 과 비교할 때도 NumType 으로 나타낸 틱 간격을 씁니다.
+    std::vector< Double > source = MakeScenario();
+    Double deltaTime = static_cast< Double >( NumType( ScenarioDeltaTime ) );
+    std::vector< NumType > expected = RunScenario< NumType >( ECharacterKernel::Scalar, source, deltaTime );
+    Bool isMatched = true;
+    ECharacterKernel supported = GetSupportedKernelOf< NumType >();
+    for ( Int32 kernel = static_cast< Int32 >( ECharacterKernel::Sse2 ); kernel <= static_cast< Int32 >( supported ); kernel++ )
+    {
+        std::vector< NumType > actual = RunScenario< NumType >( static_cast< ECharacterKernel >( kernel ), source, deltaTime );
+        Bool isSame = memcmp( expected.data(), actual.data(), expected.size() * sizeof( NumType ) ) == 0;
+        std::cout << "[CharacterKernel] " << ToString( static_cast< ECharacterKernel >( kernel ) ) << " " << GetNumTypeName< NumType >()
+                  << " : " << ( isSame ? "bit exact" : "MISMATCH" ) << "\n";
+        isMatched = isMatched && isSame;
+    }
+
+    if constexpr ( std::is_same_v< NumType, Fixed > )
+    {
+        // 다른 빌드, 머신에서 돌린 결과와 같은지 미리 구해 둔 해시로 확인합니다.
+        UInt64 checksum = GetChecksum( expected );
+        Bool isSame = checksum == FixedScenarioChecksum;
+        printf( "[CharacterKernel] Fixed checksum : %016llx / %016llx %s\n", checksum, FixedScenarioChecksum, isSame ? "deterministic" : "MISMATCH" );
+        isMatched = isMatched && isSame;
+    }
+
+    if constexpr ( !std::is_same_v< NumType, Double > )
+    {
+        // Single 은 Double 로 계산한 위치와의 차이가 스냅샷 위치 양자화 간격( 맵 크기 4 배 / 2^16 )의 1/4 안이어야 합니다.
+        // Fixed 는 단위 방향도 2^-16 으로 반올림해서 계속 돌리면 방향 오차가 쌓이므로 맵 크기의 1/10000 까지 둡니다.
+        std::vector< Double > reference = RunScenario< Double >( ECharacterKernel::Scalar, source, deltaTime );
+        Double maxDrift = 0.0;
+        for ( Int32 field = LocationX; field <= LocationY; field++ )
+        {
+            for ( Int32 i = 0; i < ScenarioCharacterCount; i++ )
+            {
+                size_t at = static_cast< size_t >( field ) * ScenarioCharacterCount + i;
+                maxDrift = std::max( maxDrift, std::abs( reference[ at ] - static_cast< Double >( expected[ at ] ) ) );
+            }
+        }
+        Double allowedDrift = std::is_same_v< NumType, Fixed > ? ScenarioMapSize * 0.0001 : ScenarioMapSize * 4.0 / 65536.0 * 0.25;
+        Bool isDriftAllowed = maxDrift <= allowedDrift;
+        std::cout << "[CharacterKernel] " << GetNumTypeName< NumType >() << " drift after " << ScenarioStepCount << " ticks : " << maxDrift << " / " << allowedDrift
+                  << ( isDriftAllowed ? " ok" : " TOO LARGE" ) << "\n";
+        isMatched = isMatched && isDriftAllowed;
+    }
+    return isMatched;
+}
+
+
+Game::CharacterStore::NumType& Game::CharacterStore::At( EField field, Int32 index )
+{
+    return fields[ static_cast< size_t >( field ) * count + index ];
+}
+
+
+Game::CharacterStore::NumType Game::CharacterStore::At( EField field, Int32 index ) const
+{
+    return fields[ static_cast< size_t >( field ) * count + index ];
+}
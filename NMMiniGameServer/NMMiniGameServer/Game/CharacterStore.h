@@ -0,0 +1,90 @@
+﻿// =================================================================================================
+//  @file CharacterStore.h
+// 
+//  @brief 방 캐릭터의 위치, 속도, 방향 같은 값을 필드별 배열로 모아 한 번에 적분합니다.
+//  
+//  @date 2026/10/17
+// 
+//  Copyright 2026 2022 Netmarble Neo, Inc. All Rights Reserved.
+// =================================================================================================
+
+
+#pragma once
+#include "Define/DataTypes.h"
+#include "Game/Vector.h"
+#include <memory_resource>
+#include <vector>
+
+
+namespace Game
+{
+    enum class ECharacterKernel : Int32
+    {
+        Scalar,
+        Sse2,
+        Avx2,
+    };
+
+    inline const char* ToString( ECharacterKernel e )
+    {
+        switch ( e )
+        {
+            case ECharacterKernel::Scalar :
+                return "Scalar";
+            case ECharacterKernel::Sse2 :
+                return "Sse2";
+            case ECharacterKernel::Avx2 :
+                return "Avx2";
+            default :
+                return "unknown";
+        }
+    }
+
+    // 필드마다 캐릭터 수만큼 이어붙인 배열 하나에 담습니다, fields[ 필드 * count + 캐릭터 ].
+    // 성분 타입은 SimulationVector 를 따르고, 평면 위에서만 움직이므로 z 는 두지 않습니다.
+    // 적분 커널은 SIMD 로 여러 캐릭터를 한 번에 계산하고, 남은 캐릭터는 스칼라로 계산합니다.
+    // 모든 커널은 같은 순서로 같은 연산을 하므로 결과가 비트 단위로 같습니다.
+    class CharacterStore
+    {
+        friend class PlayerCharacter;
+
+    public:
+        using NumType = SimulationVector::NumType;
+
+        enum EField : Int32
+        {
+            LocationX,
+            LocationY,
+            SpeedX,
+            SpeedY,
+            ForwardX,
+            ForwardY,
+            MoveSpeed,
+            MoveFlag, // 움직이는 중이면 1, 아니면 0
+            Radius,
+            Weight,
+            FieldCount,
+        };
+
+    private:
+        Int32 count = 0;
+        std::pmr::vector< NumType > fields;
+
+    public:
+        CharacterStore( Int32 count, std::pmr::memory_resource* resource );
+
+        Int32 GetCount() const;
+        void Integrate( Double deltaTime );
+
+        static void SelectKernel( ECharacterKernel requested );
+        static ECharacterKernel GetKernel();
+        // 정해진 입력으로 모든 커널을 스칼라 결과와 비트 단위로 비교하고,
+        // NumType 이 Double 이 아니면 같은 입력을 Double 로 계산한 위치와의 오차도 확인합니다.
+        // NumType 이 Fixed 면 결과 해시가 미리 구해 둔 값과 같은지도 확인합니다.
+        static Bool VerifyKernels();
+
+    private:
+        NumType& At( EField field, Int32 index );
+        NumType At( EField field, Int32 index ) const;
+    };
+};
@@ -0,0 +1,52 @@
+﻿// =================================================================================================
+//  @file CountingResource.h
+// 
+//  @brief 전역 힙으로 가는 할당 횟수를 세는 메모리 리소스입니다, 아레나의 upstream 으로 씁니다.
+//  
+//  @date 2026/10/17
+// 
+//  Copyright 2026 2022 Netmarble Neo, Inc. All Rights Reserved.
+// =================================================================================================
+
+
+#pragma once
+#include "Define/DataTypes.h"
+#include <memory_resource>
+
+
+namespace Game
+{
+    // 한 스레드에서만 씁니다.
+    class CountingResource : public std::pmr::memory_resource
+    {
+    private:
+        UInt64 allocationCount = 0;
+
+    public:
+        UInt64 TakeAllocationCount()
+        {
+            UInt64 count = allocationCount;
+            allocationCount = 0;
+            return count;
+        }
+
+    private:
+        void* do_allocate( std::size_t bytes, std::size_t alignment ) override
+        {
+            allocationCount++;
+            return std::pmr::new_delete_resource()->allocate( bytes, alignment );
+        }
+
+
+        void do_deallocate( void* pointer, std::size_t bytes, std::size_t alignment ) override
+        {
+            std::pmr::new_delete_resource()->deallocate( pointer, bytes, alignment );
+        }
+
+
+        bool do_is_equal( const std::pmr::memory_resource& other ) const noexcept override
+        {
+            return this == &other;
+        }
+    };
+};
@@ -0,0 +1,216 @@
+﻿// =================================================================================================
+//  @file Fixed.cpp
+// 
+//  @brief 정수 연산만 쓰는 고정 소수점 수입니다. 어느 컴파일러, CPU 에서도 같은 결과가 나옵니다.
+//  
+//  @date 2026/10/17
+// 
+//  Copyright 2026 2022 Netmarble Neo, Inc. All Rights Reserved.
+// =================================================================================================
+
+
+#include "Game/Fixed.h"
+#include <array>
+
+
+namespace
+{
+    constexpr Int32 StepsPerDegree = 4;
+    constexpr Int32 SinTableSize = 90 * StepsPerDegree + 1;
+    constexpr Int64 OneQ30 = 1LL << 30;
+    constexpr Int64 PiQ30 = 3373259426; // π * 2^30
+
+    constexpr Int64 RoundShift30( Int64 value )
+    {
+        return ( value + ( OneQ30 >> 1 ) ) >> 30;
+    }
+
+
+    // 라이브러리 sin 은 구현마다 마지막 비트가 다를 수 있어서, Q30 정수 테일러 급수로 표를 만듭니다.
+    // [ 0, π/2 ] 에서 8 항까지 더하면 급수 오차는 2^-30 보다 작습니다.
+    constexpr Int64 SinQ30( Int64 x )
+    {
+        Int64 square = RoundShift30( x * x );
+        Int64 term = x;
+        Int64 sum = x;
+        for ( Int64 n = 1; n <= 7; n++ )
+        {
+            term = -RoundShift30( term * square ) / ( ( 2 * n ) * ( 2 * n + 1 ) );
+            sum += term;
+        }
+        return sum;
+    }
+
+
+    constexpr std::array< Int64, SinTableSize > MakeSinTable()
+    {
+        std::array< Int64, SinTableSize > table = {};
+        for ( Int32 i = 0; i < SinTableSize; i++ )
+        {
+            Int64 radian = ( PiQ30 * i + 90 * StepsPerDegree ) / ( 180 * StepsPerDegree );
+            table[ i ] = SinQ30( radian );
+        }
+        table[ SinTableSize - 1 ] = OneQ30;
+        return table;
+    }
+
+
+    constexpr std::array< Int64, SinTableSize > SinTable = MakeSinTable();
+    static_assert( SinTable[ 0 ] == 0 && SinTable[ SinTableSize - 2 ] < OneQ30, "sin table is broken" );
+
+    // atan( 2^-i ) * 2^30, 미리 계산해 둔 정수값입니다.
+    constexpr Int64 AtanTable[] = {
+        843314857, 497837829, 263043837, 133525159, 67021687, 33543516, 16775851, 8388437,
+        4194283, 2097149, 1048576, 524288, 262144, 131072, 65536, 32768,
+        16384, 8192, 4096, 2048, 1024, 512, 256, 128,
+        64, 32, 16, 8, 4, 2,
+    };
+}
+
+
+Game::Fixed Game::Fixed::Sqrt( Fixed value )
+{
+    // raw * 2^16 의 정수 제곱근이 결과의 raw 입니다. 한 비트씩 정하는 방식이라 나눗셈이 없습니다.
+    assert( value.raw >= 0 );
+    UInt64 remain = static_cast< UInt64 >( value.raw ) << FractionBits;
+    UInt64 result = 0;
+    UInt64 bit = 1ULL << 62;
+    while ( bit > remain ) bit >>= 2;
+    while ( bit != 0 )
+    {
+        if ( remain >= result + bit )
+        {
+            remain -= result + bit;
+            result = ( result >> 1 ) + bit;
+        }
+        else
+        {
+            result >>= 1;
+        }
+        bit >>= 2;
+    }
+    return FromRaw( static_cast< Int64 >( result ) );
+}
+
+
+Game::Fixed Game::Fixed::SinDegree( Fixed degree )
+{
+    Int64 sinValue = 0;
+    Int64 cosValue = 0;
+    SinCosQ30( degree, sinValue, cosValue );
+    return FromRaw( ( sinValue + ( 1 << 13 ) ) >> 14 );
+}
+
+
+Game::Fixed Game::Fixed::CosDegree( Fixed degree )
+{
+    Int64 sinValue = 0;
+    Int64 cosValue = 0;
+    SinCosQ30( degree, sinValue, cosValue );
+    return FromRaw( ( cosValue + ( 1 << 13 ) ) >> 14 );
+}
+
+
+void Game::Fixed::Rotate( Fixed degree, Fixed& x, Fixed& y )
+{
+    Int64 sinValue = 0;
+    Int64 cosValue = 0;
+    SinCosQ30( degree, sinValue, cosValue );
+    Int64 newX = RoundShift30( cosValue * x.raw - sinValue * y.raw );
+    Int64 newY = RoundShift30( sinValue * x.raw + cosValue * y.raw );
+    x.raw = newX;
+    y.raw = newY;
+}
+
+
+Game::Fixed Game::Fixed::Atan2( Fixed y, Fixed x )
+{
+    // CORDIC 벡터 모드, 덧셈과 시프트로 ( x, y ) 를 x 축까지 돌리면서 돌린 각도를 Q30 으로 더합니다.
+    Int64 vx = x.raw;
+    Int64 vy = y.raw;
+    if ( vx == 0 && vy == 0 ) return Fixed();
+    Int64 angle = 0;
+    if ( vx < 0 )
+    {
+        // 오른쪽 반평면으로 180 도 돌려둡니다.
+        angle = vy >= 0 ? PiQ30 : -PiQ30;
+        vx = -vx;
+        vy = -vy;
+    }
+    // 시프트로 잃는 비트가 없도록 크기를 2^39 ~ 2^40 으로 맞춥니다.
+    Int64 magnitude = vx > ( vy < 0 ? -vy : vy ) ? vx : ( vy < 0 ? -vy : vy );
+    while ( magnitude < ( 1LL << 39 ) )
+    {
+        vx *= 2;
+        vy *= 2;
+        magnitude *= 2;
+    }
+    while ( magnitude >= ( 1LL << 40 ) )
+    {
+        vx /= 2;
+        vy /= 2;
+        magnitude /= 2;
+    }
+    for ( Int32 i = 0; i < static_cast< Int32 >( sizeof( AtanTable ) / sizeof( AtanTable[ 0 ] ) ); i++ )
+    {
+        // y 가 양수면 시계 방향, 아니면 반시계 방향으로 atan( 2^-i ) 만큼 돌립니다.
+        Int64 nextX = 0;
+        if ( vy > 0 )
+        {
+            nextX = vx + ( vy >> i );
+            vy -= vx >> i;
+            angle += AtanTable[ i ];
+        }
+        else
+        {
+            nextX = vx - ( vy >> i );
+            vy += vx >> i;
+            angle -= AtanTable[ i ];
+        }
+        vx = nextX;
+    }
+    return FromRaw( ( angle + ( 1 << 13 ) ) >> 14 );
+}
+
+
+void Game::Fixed::SinCosQ30( Fixed degree, Int64& sinValue, Int64& cosValue )
+{
+    // 0 ~ 90 도로 접어서 가장 가까운 표 칸을 찾고, 남은 각도 h 는 sin( a + h ) = sin a cos h + cos a sin h 로 보정합니다.
+    const Int64 quarter = 90 * One;
+    const Int64 step = One / StepsPerDegree;
+    Int64 angle = degree.raw % ( 4 * quarter );
+    if ( angle < 0 ) angle += 4 * quarter;
+    Int64 quadrant = angle / quarter;
+    Int64 inQuarter = angle % quarter;
+
+    Int64 index = ( inQuarter + step / 2 ) / step;
+    Int64 remain = inQuarter - index * step;
+    Int64 h = remain * PiQ30 / ( 180 * One );
+    Int64 hSquare = RoundShift30( h * h );
+    Int64 sinH = h - RoundShift30( h * hSquare ) / 6;
+    Int64 cosH = OneQ30 - hSquare / 2 + RoundShift30( hSquare * hSquare ) / 24;
+    Int64 sinA = SinTable[ index ];
+    Int64 cosA = SinTable[ SinTableSize - 1 - index ];
+    Int64 s = RoundShift30( sinA * cosH + cosA * sinH );
+    Int64 c = RoundShift30( cosA * cosH - sinA * sinH );
+
+    switch ( quadrant )
+    {
+        case 0 :
+            sinValue = s;
+            cosValue = c;
+            break;
+        case 1 :
+            sinValue = c;
+            cosValue = -s;
+            break;
+        case 2 :
+            sinValue = -s;
+            cosValue = -c;
+            break;
+        default :
+            sinValue = -c;
+            cosValue = s;
+            break;
+    }
+}
@@ -0,0 +1,122 @@
+﻿// =================================================================================================
+//  @file Fixed.h
+// 
+//  @brief 정수 연산만 쓰는 고정 소수점 수입니다. 어느 컴파일러, CPU 에서도 같은 결과가 나옵니다.
+//  
+//  @date 2026/10/17
+// 
+//  Copyright 2026 2022 Netmarble Neo, Inc. All Rights Reserved.
+// =================================================================================================
+
+
+#pragma once
+#include "Define/DataTypes.h"
+#include <cassert>
+#include <type_traits>
+
+
+namespace Game
+{
+    // Int64 에 소수부 16 비트를 둡니다 ( Q47.16 ).
+    // 곱셈 중간값이 Int64 를 넘지 않도록 두 값의 곱은 2^31 안이어야 합니다. 맵 크기의 제곱도 충분히 들어갑니다.
+    // 곱셈과 나눗셈은 가장 가까운 값으로 반올림합니다.
+    struct Fixed
+    {
+        static constexpr Int32 FractionBits = 16;
+        static constexpr Int64 One = 1LL << FractionBits;
+
+        Int64 raw = 0;
+
+
+        constexpr Fixed()
+        {
+        }
+
+
+        template < typename ArithTy, typename = std::enable_if_t< std::is_arithmetic_v< ArithTy > > >
+        constexpr explicit Fixed( ArithTy value )
+            : raw( ToRaw( value ) )
+        {
+        }
+
+
+        static constexpr Fixed FromRaw( Int64 raw )
+        {
+            Fixed value;
+            value.raw = raw;
+            return value;
+        }
+
+
+        explicit operator Double() const
+        {
+            return static_cast< Double >( raw ) / static_cast< Double >( One );
+        }
+
+
+        explicit operator Single() const
+        {
+            return static_cast< Single >( static_cast< Double >( *this ) );
+        }
+
+
+        Fixed operator+( Fixed v ) const { return FromRaw( raw + v.raw ); }
+        Fixed operator-( Fixed v ) const { return FromRaw( raw - v.raw ); }
+        Fixed operator-() const { return FromRaw( -raw ); }
+
+        Fixed operator*( Fixed v ) const
+        {
+            return FromRaw( RoundShift( raw * v.raw ) );
+        }
+
+
+        Fixed operator/( Fixed v ) const
+        {
+            assert( v.raw != 0 );
+            Int64 numerator = raw * One;
+            Int64 half = ( v.raw < 0 ? -v.raw : v.raw ) / 2;
+            return FromRaw( ( ( numerator < 0 ) == ( v.raw < 0 ) ? numerator + half : numerator - half ) / v.raw );
+        }
+
+
+        Fixed& operator+=( Fixed v ) { return *this = *this + v; }
+        Fixed& operator-=( Fixed v ) { return *this = *this - v; }
+        Fixed& operator*=( Fixed v ) { return *this = *this * v; }
+        Fixed& operator/=( Fixed v ) { return *this = *this / v; }
+
+        Bool operator==( Fixed v ) const { return raw == v.raw; }
+        Bool operator!=( Fixed v ) const { return raw != v.raw; }
+        Bool operator<( Fixed v ) const { return raw < v.raw; }
+        Bool operator<=( Fixed v ) const { return raw <= v.raw; }
+        Bool operator>( Fixed v ) const { return raw > v.raw; }
+        Bool operator>=( Fixed v ) const { return raw >= v.raw; }
+
+        static Fixed Sqrt( Fixed value );
+        // 각도는 도 단위입니다. 0.25 도 간격 표에서 가까운 값을 찾고, 남은 각도는 짧은 테일러 급수로 보정합니다.
+        static Fixed SinDegree( Fixed degree );
+        static Fixed CosDegree( Fixed degree );
+        // 틱마다 같은 각도로 돌려도 오차가 쌓이지 않도록 2^-30 정밀도의 sin, cos 으로 돌린 뒤 반올림합니다.
+        static void Rotate( Fixed degree, Fixed& x, Fixed& y );
+        // std::atan2 와 같이 라디안 [ -π, π ] 를 돌려줍니다.
+        static Fixed Atan2( Fixed y, Fixed x );
+
+    private:
+        static void SinCosQ30( Fixed degree, Int64& sinValue, Int64& cosValue );
+
+        template < typename ArithTy >
+        static constexpr Int64 ToRaw( ArithTy value )
+        {
+            // 설정 값 같은 실수는 한 번만 바꾸고, 가까운 값으로 반올림합니다.
+            if constexpr ( std::is_floating_point_v< ArithTy > )
+                return static_cast< Int64 >( static_cast< Double >( value ) * One + ( value < 0 ? -0.5 : 0.5 ) );
+            else
+                return static_cast< Int64 >( value ) * One;
+        }
+
+
+        static constexpr Int64 RoundShift( Int64 value )
+        {
+            return ( value + ( One >> 1 ) ) >> FractionBits;
+        }
+    };
+};
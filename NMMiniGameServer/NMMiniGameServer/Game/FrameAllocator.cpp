@@ -0,0 +1,58 @@
+﻿// =================================================================================================
+//  @file FrameAllocator.cpp
+// 
+//  @brief 한 틱 동안만 쓰는 임시 컨테이너용 스레드별 범프 할당기입니다.
+//  
+//  @date 2026/10/17
+// 
+//  Copyright 2026 2022 Netmarble Neo, Inc. All Rights Reserved.
+// =================================================================================================
+
+
+#include "Game/FrameAllocator.h"
+#include "Game/CountingResource.h"
+#include "Define/MapData.h"
+#include <vector>
+
+
+namespace
+{
+    struct FrameScratch
+    {
+        std::vector< Byte > buffer;
+        Game::CountingResource upstream;
+        std::pmr::monotonic_buffer_resource resource;
+
+
+        FrameScratch()
+            : buffer( Constant::ServerFrameScratchBytes ), resource( buffer.data(), buffer.size(), &upstream )
+        {
+        }
+    };
+
+
+    FrameScratch& GetFrameScratch()
+    {
+        thread_local FrameScratch scratch;
+        return scratch;
+    }
+}
+
+
+std::pmr::memory_resource* Game::FrameAllocator::GetResource()
+{
+    return &GetFrameScratch().resource;
+}
+
+
+void Game::FrameAllocator::Reset()
+{
+    GetFrameScratch().resource.release();
+}
+
+
+UInt64 Game::FrameAllocator::TakeOverflowCount()
+{
+    // 블록을 넘쳐 힙에서 가져간 횟수, 0 이 아니면 ServerFrameScratchBytes 를 늘려야 합니다.
+    return GetFrameScratch().upstream.TakeAllocationCount();
+}
@@ -0,0 +1,28 @@
+﻿// =================================================================================================
+//  @file FrameAllocator.h
+// 
+//  @brief 한 틱 동안만 쓰는 임시 컨테이너용 스레드별 범프 할당기입니다.
+//  
+//  @date 2026/10/17
+// 
+//  Copyright 2026 2022 Netmarble Neo, Inc. All Rights Reserved.
+// =================================================================================================
+
+
+#pragma once
+#include "Define/DataTypes.h"
+#include <memory_resource>
+
+
+namespace Game
+{
+    // Server::Process 가 매 틱 처음에 Reset 을 호출하므로, 여기서 받은 메모리는 틱을 넘겨 들고 있으면 안 됩니다.
+    // 스레드마다 ServerFrameScratchBytes 크기 블록을 하나 가지고, 넘치면 힙에서 가져온 뒤 Reset 에서 돌려줍니다.
+    class FrameAllocator
+    {
+    public:
+        static std::pmr::memory_resource* GetResource();
+        static void Reset();
+        static UInt64 TakeOverflowCount();
+    };
+};
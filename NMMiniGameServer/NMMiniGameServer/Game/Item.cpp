@@ -2,7 +2,7 @@
 #include "Define/MapData.h"
 
 
-Game::Item::Item( Int32 index, Vector location, EItemType type )
+Game::Item::Item( Int32 index, SimulationVector location, EItemType type )
     : index(index), location( location ), type( type ), radius( Constant::ItemRadius )
 {
     spawnTime.SetNow( );
@@ -21,13 +21,13 @@ void Game::Item::SetType( EItemType type )
 }
 
 
-Game::Vector Game::Item::GetLocation() const
+Game::SimulationVector Game::Item::GetLocation() const
 {
     return location;
 }
 
 
-void Game::Item::SetLocation( const Game::Vector& location )
+void Game::Item::SetLocation( const Game::SimulationVector& location )
 {
     this->location = location;
 }
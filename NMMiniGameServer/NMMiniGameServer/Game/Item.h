@@ -21,18 +21,18 @@ namespace Game
     class Item
     {
         Timer spawnTime;
-        Vector location;
+        SimulationVector location;
         Double radius;
         EItemType type;
         Int32 index;
     public:
-        Item( Int32 index, Vector location, EItemType type );
+        Item( Int32 index, SimulationVector location, EItemType type );
 
         EItemType GetType() const;
         void SetType( EItemType type );
 
-        Vector GetLocation() const;
-        void SetLocation( const Vector& location );
+        SimulationVector GetLocation() const;
+        void SetLocation( const SimulationVector& location );
 
         Double GetRadius() const;
         void SetRadius( Double radius );
@@ -15,6 +15,7 @@
 #include <type_traits>
 #include <iostream>
 #include <map>
+#include <memory_resource>
 
 
 namespace Game
@@ -59,15 +60,19 @@ namespace Game
         using StateFunctionOnUpdate = std::function< StateFuncResult< EStateEnum >( Double deltaTime ) >;
         using StateFunctionOnExit = std::function< void( EStateEnum nextState ) >;
     private:
-        std::map< EStateEnum, StateFunctionOnEnter > onEnterFunctions;
-        std::map< EStateEnum, StateFunctionOnReceiveInput > onReceiveInputFunctions;
-        std::map< EStateEnum, StateFunctionOnUpdate > onUpdateFunctions;
-        std::map< EStateEnum, StateFunctionOnExit > onExitFunctions;
+        std::pmr::map< EStateEnum, StateFunctionOnEnter > onEnterFunctions;
+        std::pmr::map< EStateEnum, StateFunctionOnReceiveInput > onReceiveInputFunctions;
+        std::pmr::map< EStateEnum, StateFunctionOnUpdate > onUpdateFunctions;
+        std::pmr::map< EStateEnum, StateFunctionOnExit > onExitFunctions;
         EStateEnum currentState;
 
     public:
-        LambdaFSM()
-            : currentState( static_cast< EStateEnum >( 0 ) )
+        explicit LambdaFSM( std::pmr::memory_resource* resource = std::pmr::get_default_resource() )
+            : onEnterFunctions( resource ),
+              onReceiveInputFunctions( resource ),
+              onUpdateFunctions( resource ),
+              onExitFunctions( resource ),
+              currentState( static_cast< EStateEnum >( 0 ) )
         {
             static_assert( isValid, "EStateEnum is must enum" );
         }
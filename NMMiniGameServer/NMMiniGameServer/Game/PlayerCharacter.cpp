@@ -16,75 +16,84 @@
 #include <iostream>
 
 
-Game::PlayerCharacter::PlayerCharacter()
-    : location( 0 ), speed( 0 ), forward( 0, 1, 0 ), defaultMove( Constant::CharacterDefaultSpeed ), radius( Constant::CharacterRadius ), weight( Constant::CharacterWeight )
+Game::PlayerCharacter::PlayerCharacter( CharacterStore* store, Int32 index, std::pmr::memory_resource* resource )
+    : store( store ), index( index ), collidFillter( resource )
 {
+    SetLocation( SimulationVector( 0 ) );
+    SetSpeed( SimulationVector( 0 ) );
+    SetForward( SimulationVector( 0, 1 ) );
+    SetMoveSpeed( Constant::CharacterDefaultSpeed );
+    SetRadius( Constant::CharacterRadius );
+    SetWeight( Constant::CharacterWeight );
+    StopMove();
 }
 
 
 void Game::PlayerCharacter::RotateLeft( Double value )
 {
-    forward.Rotate2D( -value );
+    SetForward( GetForward().Rotated2D( -value ) );
 }
 
 
 void Game::PlayerCharacter::RotateRight( Double value )
 {
-    forward.Rotate2D( value );
+    SetForward( GetForward().Rotated2D( value ) );
 }
 
 
-const Game::Vector& Game::PlayerCharacter::GetSpeed() const
+Game::SimulationVector Game::PlayerCharacter::GetSpeed() const
 {
-    return speed;
+    return GetField( CharacterStore::SpeedX );
 }
 
 
-Game::PlayerCharacter& Game::PlayerCharacter::SetSpeed( const Vector& speed )
+Game::PlayerCharacter& Game::PlayerCharacter::SetSpeed( const SimulationVector& speed )
 {
-    this->speed = speed;
+    SetField( CharacterStore::SpeedX, speed );
     return *this;
 }
 
 
-Game::PlayerCharacter& Game::PlayerCharacter::AddSpeed( const Vector& speed )
+Game::PlayerCharacter& Game::PlayerCharacter::AddSpeed( const SimulationVector& speed )
 {
-    this->speed += speed;
+    SetSpeed( GetSpeed() + speed );
     return *this;
 }
 
 
 Game::PlayerCharacter& Game::PlayerCharacter::ClampSpeed( const Double& speed )
 {
-    auto length =  this->speed.GetLength();
-    this->speed.Normalize();
-    this->speed *= std::min( length, speed );
+    SimulationVector current = GetSpeed();
+    auto length = current.GetLength();
+    current.Normalize();
+    current *= std::min( length, SimulationNum( speed ) );
+    SetSpeed( current );
     return *this;
 }
 
 
-const Double& Game::PlayerCharacter::GetMoveSpeed() const
+Game::SimulationNum Game::PlayerCharacter::GetMoveSpeed() const
 {
-    return defaultMove;
+    return store->At( CharacterStore::MoveSpeed, index );
 }
 
 
 Game::PlayerCharacter& Game::PlayerCharacter::SetMoveSpeed( const Double& speed )
 {
-    defaultMove = speed;
+    store->At( CharacterStore::MoveSpeed, index ) = SimulationNum( speed );
     return *this;
 }
 
 
-const Double& Game::PlayerCharacter::GetWeight() const
+Game::SimulationNum Game::PlayerCharacter::GetWeight() const
 {
-    return  isInfiniteWeight ? Constant::CharacterInfiniteWeight : weight;
+    return isInfiniteWeight ? SimulationNum( Constant::CharacterInfiniteWeight ) : store->At( CharacterStore::Weight, index );
 }
 
 
 Game::PlayerCharacter& Game::PlayerCharacter::SetWeight( const Double& weight )
 {
-    this->weight = weight;
+    store->At( CharacterStore::Weight, index ) = SimulationNum( weight );
     return *this;
 }
 
@@ -96,86 +105,72 @@ Game::PlayerCharacter& Game::PlayerCharacter::SetInfiniteWeight( bool isInfinite
 }
 
 
-const Game::Vector& Game::PlayerCharacter::GetLocation() const
+Game::SimulationVector Game::PlayerCharacter::GetLocation() const
 {
-    return location;
+    return GetField( CharacterStore::LocationX );
 }
 
 
-Game::PlayerCharacter& Game::PlayerCharacter::SetLocation( const Vector& location )
+Game::PlayerCharacter& Game::PlayerCharacter::SetLocation( const SimulationVector& location )
 {
-    this->location = location;
+    SetField( CharacterStore::LocationX, location );
     return *this;
 }
 
 
-const Double& Game::PlayerCharacter::GetRadius() const
+Game::SimulationNum Game::PlayerCharacter::GetRadius() const
 {
-    return radius;
+    return store->At( CharacterStore::Radius, index );
 }
 
 
 Game::PlayerCharacter& Game::PlayerCharacter::SetRadius( Double radius )
 {
-    this->radius = radius;
+    store->At( CharacterStore::Radius, index ) = SimulationNum( radius );
     return *this;
 }
 
 
 Game::PlayerCharacter& Game::PlayerCharacter::SetRotation( Double rotation )
 {
-    const auto defualtForward = Vector( 0, 1, 0 );
-    forward = defualtForward.Rotated2D( rotation, false );
+    const auto defualtForward = SimulationVector( 0, 1 );
+    SetForward( defualtForward.Rotated2D( rotation, false ) );
     return *this;
 }
 
 
 void Game::PlayerCharacter::StartMove()
 {
-    this->isMove = true;
+    store->At( CharacterStore::MoveFlag, index ) = SimulationNum( 1 );
 }
 
 
 void Game::PlayerCharacter::StopMove()
 {
-    this->isMove = false;
+    store->At( CharacterStore::MoveFlag, index ) = SimulationNum( 0 );
 }
 
 
-const Game::Vector& Game::PlayerCharacter::GetForward() const
+Game::SimulationVector Game::PlayerCharacter::GetForward() const
 {
-    return forward;
+    return GetField( CharacterStore::ForwardX );
 }
 
 
-Game::Vector Game::PlayerCharacter::GetFinalSpeed() const
+Game::SimulationVector Game::PlayerCharacter::GetFinalSpeed() const
 {
-    return speed + (forward * ( isMove ? defaultMove : 0.0 ));
+    Bool isMove = store->At( CharacterStore::MoveFlag, index ) != SimulationNum( 0 );
+    return GetSpeed() + (GetForward() * ( isMove ? GetMoveSpeed() : SimulationNum( 0 ) ));
 }
 
 
-Game::PlayerCharacter& Game::PlayerCharacter::SetForward( const Vector& forward )
+Game::PlayerCharacter& Game::PlayerCharacter::SetForward( const SimulationVector& forward )
 {
-    this->forward = forward;
+    SetField( CharacterStore::ForwardX, forward );
     return *this;
 }
 
 
-void Game::PlayerCharacter::Update( Double deltaTime )
-{
-
-    location += GetFinalSpeed() * deltaTime;
-    assert( location.IsNan() == false );
-    // 
-    if ( !speed.IsZero() )
-    {
-        Vector Friction = -speed.Normalized() * Constant::CharacterFriction * deltaTime * 2.0f;
-        if ( speed.GetSqr() < Friction.GetSqr() ) speed = Vector::Zero();
-        else speed = speed + Friction;
-    }
-}
-
-
 void Game::PlayerCharacter::TurnOnColliderFillter( const PlayerCharacter& other )
 {
     collidFillter.insert( &other );
@@ -192,3 +187,18 @@ bool Game::PlayerCharacter::GetColliderFillter( const PlayerCharacter& other ) c
 {
     return collidFillter.count( &other );
 }
+
+
+Game::SimulationVector Game::PlayerCharacter::GetField( CharacterStore::EField x ) const
+{
+    // x, y ʵ enum  ̾ ֽϴ.
+    return SimulationVector( store->At( x, index ),
+                             store->At( static_cast< CharacterStore::EField >( x + 1 ), index ) );
+}
+
+
+void Game::PlayerCharacter::SetField( CharacterStore::EField x, const SimulationVector& value )
+{
+    store->At( x, index ) = value.x;
+    store->At( static_cast< CharacterStore::EField >( x + 1 ), index ) = value.y;
+}
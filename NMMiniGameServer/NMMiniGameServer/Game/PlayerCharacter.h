@@ -12,44 +12,43 @@
 #pragma once
 #include "Define/DataTypes.h"
 #include "Vector.h"
+#include "Game/CharacterStore.h"
+#include <memory_resource>
 #include <set>
 
 
 namespace Game
 {
+    // ġ, ӵ, , , Դ  CharacterStore  ΰ index ° ĭ а ϴ.
+    // ̵   CharacterStore::Integrate   ĳ͸   մϴ.
     class PlayerCharacter
     {
     private:
-        Vector location;
-        Vector speed;
-        Vector forward;
-        Double defaultMove;
-        Double radius;
-        Double weight;
-        bool isMove = false;
+        CharacterStore* store = nullptr;
+        Int32 index = 0;
         bool isInfiniteWeight = false;
-        std::set< const void* > collidFillter; // ѹ 浹ǵ ͸մϴ.
+        std::pmr::set< const void* > collidFillter; // ѹ 浹ǵ ͸մϴ.
     public:
-        PlayerCharacter();
+        PlayerCharacter( CharacterStore* store, Int32 index, std::pmr::memory_resource* resource );
         void RotateLeft( Double value );
         void RotateRight( Double value );
 
-        const Vector& GetSpeed() const;
-        PlayerCharacter& SetSpeed( const Vector& speed );
-        PlayerCharacter& AddSpeed( const Vector& speed );
+        SimulationVector GetSpeed() const;
+        PlayerCharacter& SetSpeed( const SimulationVector& speed );
+        PlayerCharacter& AddSpeed( const SimulationVector& speed );
         PlayerCharacter& ClampSpeed( const Double& speed );
 
-        const Double& GetMoveSpeed() const;
+        SimulationNum GetMoveSpeed() const;
         PlayerCharacter& SetMoveSpeed( const Double& speed );
 
-        const Double& GetWeight( ) const;
+        SimulationNum GetWeight( ) const;
         PlayerCharacter& SetWeight( const Double& weight );
         PlayerCharacter& SetInfiniteWeight( bool isInfiniteWeight );
 
-        const Vector& GetLocation() const;
-        PlayerCharacter& SetLocation( const Vector& location );
+        SimulationVector GetLocation() const;
+        PlayerCharacter& SetLocation( const SimulationVector& location );
 
-        const Double& GetRadius() const;
+        SimulationNum GetRadius() const;
         PlayerCharacter& SetRadius( Double radius );
 
         PlayerCharacter& SetRotation( Double rotation );
@@ -57,12 +56,15 @@ namespace Game
         void StartMove();
         void StopMove();
 
-        const Vector& GetForward() const;
-        Vector GetFinalSpeed() const;
-        PlayerCharacter& SetForward( const Vector& forward );
-        void Update( Double deltaTime );
+        SimulationVector GetForward() const;
+        SimulationVector GetFinalSpeed() const;
+        PlayerCharacter& SetForward( const SimulationVector& forward );
         void TurnOnColliderFillter( const PlayerCharacter& other );
         void TurnOffColliderFillter( const PlayerCharacter& other );
         bool GetColliderFillter( const PlayerCharacter& other ) const;
+
+    private:
+        SimulationVector GetField( CharacterStore::EField x ) const;
+        void SetField( CharacterStore::EField x, const SimulationVector& value );
     };
 };
@@ -24,18 +24,47 @@ Int32 Game::PlayerController::GetPlayerIndex() const
 }
 
 
-Game::PlayerController::PlayerController()
+Game::PlayerController::PlayerController( std::pmr::memory_resource* resource )
+    : fsm( resource )
 {
     this->AddStateFunctions();
 }
 
 
-void Game::PlayerController::SetSession( Network::Session* session )
+void Game::PlayerController::Reset()
+{
+    //  Լ this   Ƿ ٽ  ʰ  ǵϴ.
+    character = nullptr;
+    session = Network::NullSessionHandle;
+    room = nullptr;
+    playerIndex = 0;
+    currentItem = EItemType::None;
+    rushCount = 0;
+    lastCollidedPlayerIndex = Constant::NullPlayerIndex;
+    rushRecastTime = Constant::CharacterRushMinimumRecastSeconds;
+    hasPendingState = false;
+    hasSentLocation = false;
+    timerItemChanged = Timer();
+    timerRushUse = Timer();
+    timerRushGen = Timer();
+    timerSpawnStart = Timer();
+    timerRespawnStart = Timer();
+    timerLastCollided = Timer();
+}
+
+
+void Game::PlayerController::SetSession( Network::SessionHandle session )
 {
     this->session = session;
 }
 
 
+Network::Session* Game::PlayerController::GetSession() const
+{
+    return room ? room->FindSession( session ) : nullptr;
+}
+
+
 void Game::PlayerController::SetCharacter( PlayerCharacter* character )
 {
     this->character = character;
@@ -66,11 +95,45 @@ void Game::PlayerController::Initialize()
 
 void Game::PlayerController::SendByte( const Byte* data, UInt64 size ) const
 {
+    Network::Session* session = GetSession();
     if ( !session ) return;
     session->SendByte( data, size );
 }
 
 
+void Game::PlayerController::SendSharedFrame( Network::SendFrame* frame ) const
+{
+    Network::Session* session = GetSession();
+    if ( !session ) return;
+    session->SendSharedFrame( frame );
+}
+
+
+Byte Game::PlayerController::GetProtocolVersion() const
+{
+    Network::Session* session = GetSession();
+    return session ? session->GetProtocolVersion() : Packet::ProtocolVersion1;
+}
+
+
+void Game::PlayerController::SendStateByte( const Byte* data, UInt64 size, Int32 stateKey ) const
+{
+    //     Ʈ, UDP   UDP , ƴϸ TCP   ϴ.
+    //  stateKey   °   ʾ ϴ.
+    Network::Session* session = GetSession();
+    if ( !session ) return;
+    session->SendUnreliableByte( data, size, stateKey );
+}
+
+
+Bool Game::PlayerController::IsStatePending( Packet::EType type, Int32 stateKey ) const
+{
+    //   ϰ ο  ° ִ, UDP   ´  ʽϴ.
+    Network::Session* session = GetSession();
+    return session && !session->IsUnreliableBound() && session->IsStatePending( type, stateKey );
+}
+
+
 void Game::PlayerController::Update( Double deltaTime )
 {
     if ( !character ) return;
@@ -94,15 +157,30 @@ void Game::PlayerController::Update( Double deltaTime )
 }
 
 
+const Network::PacketDispatcher< Game::PlayerController > Game::PlayerController::packetDispatcher =
+    Network::PacketDispatcher< PlayerController >()
+    .Register( Packet::EType::ClientInput, &PlayerController::OnInputReceived )
+    .Register( Packet::EType::ClientSnapshotAck, &PlayerController::OnSnapshotAckReceived );
+
+
 void Game::PlayerController::OnReceivedPacket( const Packet::Header* ptr )
 {
     if ( !ptr ) return;
-    switch ( ptr->Type )
-    {
-        case Packet::EType::ClientInput :
-            fsm.OnReceiveInput( *reinterpret_cast< const Packet::Client::Input* >( ptr ) );
-            break;
-    }
+    // Է ٲ Ÿ̸ӵ  ð踦  մϴ.
+    if ( room ) room->EnterSimulationClock();
+    packetDispatcher.Dispatch( *this, ptr );
+}
+
+
+void Game::PlayerController::OnInputReceived( const Packet::Header* ptr )
+{
+    fsm.OnReceiveInput( *reinterpret_cast< const Packet::Client::Input* >( ptr ) );
+}
+
+
+void Game::PlayerController::OnSnapshotAckReceived( const Packet::Header* ptr )
+{
+    room->OnSnapshotAcked( playerIndex, reinterpret_cast< const Packet::Client::SnapshotAck* >( ptr )->tick );
 }
 
 
@@ -197,6 +275,7 @@ void Game::PlayerController::SendRushCountChangedPacket() const
 
 void Game::PlayerController::LogLine( const char* format, ... ) const
 {
+    if ( room && room->IsLogMuted() ) return;
     time_t c;
     time( &c );
     tm t;
@@ -242,17 +321,20 @@ void Game::PlayerController::BroadcastObjectLocation( bool isSetHeight ) const
     packet.targetIndex = playerIndex;
     packet.chracterState = static_cast< Int32 >( GetState() );
     packet.isSetHeight = isSetHeight;
-    Vector location = character->GetLocation();
-    packet.locationX = location.x;
-    packet.locationY = location.y;
+    SimulationVector location = character->GetLocation();
+    packet.locationX = static_cast< Single >( location.x );
+    packet.locationY = static_cast< Single >( location.y );
     packet.locationZ = isSetHeight ? Constant::MapSpawnRespawnHeight : Constant::MapCharacterDefaultHeight;
     //packet.rotation = character.GetRotation();
-    Vector forward = character->GetForward();
-    packet.forwardX = forward.x;
-    packet.forwardY = forward.y;
-    packet.forwardZ = forward.z;
+    SimulationVector forward = character->GetForward();
+    packet.forwardX = static_cast< Single >( forward.x );
+    packet.forwardY = static_cast< Single >( forward.y );
+    packet.forwardZ = 0.0f;
 
-    room->BroadcastPacket( &packet );
+    //  ƽ ġ  ƽ Ƿ ŷ äη, ̵( ) TCP  ϴ.
+    //  2 Ŭ̾Ʈ  ƽ ġ Room  WorldSnapshot  ޽ϴ.
+    if ( isSetHeight ) room->BroadcastPacket( &packet );
+    else room->BroadcastUnreliablePacket( &packet, Packet::ProtocolVersion1, playerIndex );
 }
 
 
@@ -364,13 +446,45 @@ bool Game::PlayerController::IsUseRushStack() const
 
 void Game::PlayerController::SendStateChangedPacket( EPlayerState state ) const
 {
+    // ٷ  ʰ Room  ƽ  FlushStateChangedPacket    ϴ.
+    hasPendingState = true;
+    pendingState = state;
+}
+
+
+void Game::PlayerController::FlushStateChangedPacket()
+{
+    if ( !hasPendingState ) return;
+    hasPendingState = false;
     Packet::Server::ObjectStateChanged packet;
     packet.targetIndex = this->playerIndex;
-    packet.chracterState = static_cast< Byte >( state );
+    packet.chracterState = static_cast< Byte >( pendingState );
     this->room->BroadcastPacket( &packet );
 }
 
 
+Bool Game::PlayerController::UpdateLocationDirty()
+{
+    // ġ, , ӵ,   ϳ    ٸ true
+    if ( !character ) return false;
+    SimulationVector location = character->GetLocation();
+    SimulationVector forward = character->GetForward();
+    SimulationVector velocity = character->GetFinalSpeed();
+    EPlayerState state = GetState();
+    Bool isDirty = !hasSentLocation ||
+                   location.x != sentLocation.x || location.y != sentLocation.y ||
+                   forward.x != sentForward.x || forward.y != sentForward.y ||
+                   velocity.x != sentVelocity.x || velocity.y != sentVelocity.y ||
+                   state != sentState;
+    hasSentLocation = true;
+    sentLocation = location;
+    sentForward = forward;
+    sentVelocity = velocity;
+    sentState = state;
+    return isDirty;
+}
+
+
 void Game::PlayerController::AddStateFunctions()
 {
     auto defaultEnter = [this]( EPlayerState prevState ) -> StateFuncResult< EPlayerState >
@@ -563,7 +677,7 @@ void Game::PlayerController::AddStateFunctions()
     fsm.AddStateFunctionOnUpdate( EPlayerState::Rush,
                                  [this]( Double deltaTime ) -> StateFuncResult< EPlayerState >
                                  {
-                                     if ( this->character->GetSpeed().GetLength() < 20.0f )
+                                     if ( this->character->GetSpeed().GetLength() < SimulationNum( 20 ) )
                                      {
                                          return StateFuncResult< EPlayerState >( EPlayerState::Run );
                                      }
@@ -618,7 +732,7 @@ void Game::PlayerController::AddStateFunctions()
                                 {
                                     LogLine( "Entered" );
                                     timerRespawnStart.SetNow();
-                                    Vector outVector = character->GetLocation().Normalized();
+                                    SimulationVector outVector = character->GetLocation().Normalized();
                                     this->SendStateChangedPacket( EPlayerState::Die );
                                     character->StopMove( );
                                     character->AddSpeed( outVector * Constant::CharacterMapOutSpeed );
@@ -15,6 +15,9 @@
 #include "Game/LambdaFSM.h"
 #include "Game/PlayerState.h"
 #include "Game/Timer.h"
+#include "Game/Vector.h"
+#include "Network/PacketDispatcher.h"
+#include "Network/Session.h"
 #include "Game/ItemType.h"
 #include <list>
 
@@ -22,6 +25,7 @@
 namespace Network
 {
     class Session;
+    struct SendFrame;
 };
 
 
@@ -44,8 +48,10 @@ namespace Game
     class PlayerController
     {
     private:
+        static const Network::PacketDispatcher< PlayerController > packetDispatcher;
+
         class PlayerCharacter* character = nullptr;
-        Network::Session* session = nullptr;
+        Network::SessionHandle session = Network::NullSessionHandle; // Room   ãϴ,  ̸ ã մϴ
         class Room* room = nullptr;
 
         LambdaFSM< EPlayerState > fsm;
@@ -64,10 +70,22 @@ namespace Game
         Timer timerLastCollided;
         Int32 lastCollidedPlayerIndex = Constant::NullPlayerIndex;
         Double rushRecastTime = Constant::CharacterRushMinimumRecastSeconds;
+
+        //  ƽ      ϳ ϴ.
+        mutable Bool hasPendingState = false;
+        mutable EPlayerState pendingState = EPlayerState::Spawn;
+
+        //   ġ , ٲ ĳ͸   մϴ.
+        Bool hasSentLocation = false;
+        SimulationVector sentLocation;
+        SimulationVector sentForward;
+        SimulationVector sentVelocity;
+        EPlayerState sentState = EPlayerState::Spawn;
     public:
-        PlayerController();
+        explicit PlayerController( std::pmr::memory_resource* resource = std::pmr::get_default_resource() );
+        void Reset();
         ~PlayerController() = default;
-        void SetSession( Network::Session* session );
+        void SetSession( Network::SessionHandle session );
         void SetCharacter( PlayerCharacter* character );
         void SetRoom( Room* room );
         void SetPlayerIndex( Int32 playerIndex );
@@ -76,12 +94,18 @@ namespace Game
         template < class PacketType >
         void SendPacket( const PacketType* buffer ) const;
         void SendByte( const Byte* data, UInt64 size ) const;
+        void SendSharedFrame( Network::SendFrame* frame ) const;
+        Byte GetProtocolVersion() const;
+        void SendStateByte( const Byte* data, UInt64 size, Int32 stateKey ) const;
+        Bool IsStatePending( Packet::EType type, Int32 stateKey ) const;
 
         void Update( Double deltaTime );
         void OnReceivedPacket( const Packet::Header* ptr );
         EPlayerState GetState() const;
         void ChangeState( EPlayerState state );
         void BroadcastObjectLocation( bool isSetHeight ) const;
+        Bool UpdateLocationDirty();
+        void FlushStateChangedPacket();
         void OnCollided( const PlayerController& other );
         Int32 GetLastCollidedPlayerIndex() const;
         void ApplyBuff( EItemType item );
@@ -102,6 +126,9 @@ namespace Game
         void SendRushCountChangedPacket() const;
         void LogLine( const char* format, ... ) const;
         bool IsItemDurationExpired();
+        Network::Session* GetSession() const;
+        void OnInputReceived( const Packet::Header* ptr );
+        void OnSnapshotAckReceived( const Packet::Header* ptr );
     };
 
 
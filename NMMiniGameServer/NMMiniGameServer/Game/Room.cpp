@@ -12,6 +12,8 @@
 #include "Game/Room.h"
 #include "Define/MapData.h"
 #include "Define/PacketDefine.h"
+#include "Network/AllocationTracker.h"
+#include "Network/Server.h"
 #include "Network/Session.h"
 #include <algorithm>
 #include <cassert>
@@ -19,19 +21,79 @@
 #include <iostream>
 
 
-Game::Room::Room( Int32 userCount )
-    : maxUserCount( userCount ), state( ERoomState::Opened )
+Game::Room::MatchData::MatchData( std::pmr::memory_resource* resource )
+    : items( resource )
 {
-    players.resize( userCount );
-    characters.resize( userCount );
-    sessions.resize( userCount );
-    scores.resize( userCount );
+    items.reserve( Constant::ItemSameTimeMaxSpawnCount );
+}
+
+
+Game::Room::Room( Int32 userCount, Network::Server* server, Bool isSpecialized )
+    : arena( Constant::ServerRoomArenaBytes ), maxUserCount( userCount ), characterStore( userCount, arena.GetRoomResource() ), server( server ), kernel( SelectKernel( userCount, isSpecialized ) ), state( ERoomState::Opened )
+{
+    assert( userCount > 0 && userCount <= MaxPlayerCount );
+    // Ʈѷ FSM ǥ   ޸𸮿, ĳͿ  ̳ʴ  ޸𸮿 Ӵϴ.
+    // Ʈѷ  Լ this  Ƿ ̸  뷮 ȿ ϴ.
+    players.reserve( userCount );
+    characters.reserve( userCount );
+    for ( Int32 i = 0; i < userCount; i++ )
+    {
+        players.emplace_back( arena.GetRoomResource() );
+        characters.emplace_back( &characterStore, i, arena.GetMatchResource() );
+    }
+    match.emplace( arena.GetMatchResource() );
+    sessions.fill( Network::NullSessionHandle );
     currentMapSize = Constant::MapSize;
+    snapshotEncoder.Initialize( userCount );
+    snapshotAckedTicks.fill( SnapshotEncoder::NullTick );
+#ifdef SIMULATION_FIXED_POINT
+    SeedRandom( static_cast< UInt32 >( Constant::GameRandomSeed ) );
+#else
+    SeedRandom( std::random_device()() );
+#endif
 }
 
 
-Game::PlayerController* Game::Room::GetNewPlayerController( Int32 index, Network::Session* session )
+void Game::Room::Reset()
 {
+    //   Ǯ ٽ   ȣմϴ, ͵ ũ 뷮 ״ Ӵϴ.
+    //  ޸𸮸  ͵   ְ arena      ٽ ϴ.
+    currentUserCount = 0;
+    match.reset();
+    characters.clear();
+    arena.ReleaseMatch();
+    match.emplace( arena.GetMatchResource() );
+    for ( Int32 i = 0; i < maxUserCount; i++ )
+    {
+        players[ i ].Reset();
+        characters.emplace_back( &characterStore, i, arena.GetMatchResource() );
+    }
+    sessions.fill( Network::NullSessionHandle );
+    scores.fill( 0 );
+    kingUsers.reset();
+    state = ERoomState::Opened;
+    itemIndex = 0;
+    currentMapSize = Constant::MapSize;
+    mapPhase = 0;
+    shouldCheckKing = true;
+    snapshotTick = 0;
+    snapshotEncoder.Reset();
+    snapshotAckedTicks.fill( SnapshotEncoder::NullTick );
+    snapshotStatistics = SnapshotStatistics();
+    dirtyEntities.reset();
+    snapshotEntities.reset();
+#ifdef SIMULATION_FIXED_POINT
+    // ⸶  ð,   մϴ.
+    simulationTime = Timer::TimePoint();
+    SeedRandom( static_cast< UInt32 >( Constant::GameRandomSeed ) );
+#endif
+}
+
+
+Game::PlayerController* Game::Room::GetNewPlayerController( Int32 index, Network::SessionHandle session )
+{
+    //  ġ startTime  Ƿ ٸ   ð谡 ƴ϶   ð о մϴ.
+    EnterSimulationClock();
     auto& instance = players[ index ];
     auto& character = characters[ index ];
     instance.SetSession( session );
@@ -50,35 +112,36 @@ void Game::Room::SpawnItem()
     if ( itemSpawnedTime.IsOverNow() )
     {
         LogLine( "Item Spawn Check" );
-        if ( items.size() < Constant::ItemSameTimeMaxSpawnCount )
+        if ( match->items.size() < Constant::ItemSameTimeMaxSpawnCount )
         {
             LogLine( "Item Spawned" );
-            Vector location = GetRandomItemLocation();
-            std::vector< EItemType > itemPool = { EItemType::Fortify, EItemType::Ghost, EItemType::StrongWill, EItemType::SwiftMove, EItemType::Clover };
-            Int32 itemMax = this->startTime.IsOverSeconds( Constant::ItemCloverSpawnStartTime ) ? itemPool.size() : itemPool.size() - 1;
-            Int32 itemType = rand() % itemMax;
-            items.emplace_back( itemIndex, location, itemPool[itemType] );
-            BroadcastSpawnItem( items.back() );
+            SimulationVector location = GetRandomItemLocation();
+            static constexpr EItemType itemPool[] = { EItemType::Fortify, EItemType::Ghost, EItemType::StrongWill, EItemType::SwiftMove, EItemType::Clover };
+            constexpr Int32 itemPoolSize = sizeof( itemPool ) / sizeof( itemPool[ 0 ] );
+            Int32 itemMax = this->startTime.IsOverSeconds( Constant::ItemCloverSpawnStartTime ) ? itemPoolSize : itemPoolSize - 1;
+            Int32 itemType = static_cast< Int32 >( random() % itemMax );
+            match->items.emplace_back( itemIndex, location, itemPool[itemType] );
+            BroadcastSpawnItem( match->items.back() );
             itemIndex++;
         }
         Int32 maxDelta = static_cast< int >( round( Constant::ItemRegenMaxSeconds - Constant::ItemRegenMinSeconds ) );
-        Double randomSecond = Constant::ItemRegenMinSeconds + rand() % maxDelta;
+        Double randomSecond = Constant::ItemRegenMinSeconds + static_cast< Int32 >( random() % maxDelta );
         itemSpawnedTime.AddSeconds( randomSecond );
     }
 }
 
 
-Game::Vector Game::Room::GetRandomItemLocation() const
+Game::SimulationVector Game::Room::GetRandomItemLocation()
 {
-    Double angle = rand() % 360;
-    Double mapSize = rand() % static_cast< Int32 >( floor( currentMapSize ) * 0.9 );
-    return Vector( 0.0, mapSize, 0.0 ).Rotated2D( angle );
+    Double angle = static_cast< Double >( random() % 360 );
+    Double mapSize = static_cast< Double >( random() % static_cast< Int32 >( floor( currentMapSize ) * 0.9 ) );
+    return SimulationVector( 0.0, mapSize ).Rotated2D( angle );
 }
 
 
 void Game::Room::CheckCollisionItem()
 {
-    for ( auto i = items.begin(); i != items.end(); )
+    for ( auto i = match->items.begin(); i != match->items.end(); )
     {
         auto& item = *i;
         bool itemErased = false;
@@ -86,7 +149,7 @@ void Game::Room::CheckCollisionItem()
         {
             //remove by expire
             BroadcastRemoveItem( item, false );
-            i = items.erase( i );
+            i = match->items.erase( i );
             itemErased = true;
         }
         else
@@ -105,7 +168,7 @@ void Game::Room::CheckCollisionItem()
                     BroadcastRemoveItem( item, true );
                     controller.RemoveBuff();
                     controller.ApplyBuff( item.GetType() );
-                    i = items.erase( i );
+                    i = match->items.erase( i );
                     itemErased = true;
                     break;
                 }
@@ -154,9 +217,31 @@ void Game::Room::UpdateMap()
 
 void Game::Room::AddSession( Int32 index, Network::Session* session )
 {
-    sessions[ index ] = session;
+    sessions[ index ] = session->GetHandle();
     session->SetRoom( this );
-    session->SetController( GetNewPlayerController( index, session ) );
+    session->SetController( GetNewPlayerController( index, session->GetHandle() ) );
+}
+
+
+void Game::Room::AddScriptedPlayer( Int32 index )
+{
+    //    Է ִ ÷̾,  ġũ  ˻Դϴ.
+    sessions[ index ] = Network::NullSessionHandle;
+    GetNewPlayerController( index, Network::NullSessionHandle );
+}
+
+
+void Game::Room::OnScriptedInput( Int32 index, const Packet::Client::Input& input )
+{
+    EnterSimulationClock();
+    players[ index ].OnReceivedPacket( &input.header );
+}
+
+
+Network::Session* Game::Room::FindSession( Network::SessionHandle handle ) const
+{
+    // ܼ   nullptr Դϴ.
+    return server ? server->FindSession( handle ) : nullptr;
 }
 
 
@@ -171,13 +256,120 @@ void Game::Room::UpdatePlayerController( Double deltaTime )
 
 void Game::Room::UpdateCharacter( Double deltaTime )
 {
+    // ٲ ĳ͸ , ֱ ü ٽ  ߳ Ŭ̾Ʈ ϴ.
+    Bool isKeyframe = Constant::ServerKeyframeTickInterval <= 0 || snapshotTick % Constant::ServerKeyframeTickInterval == 0;
+    Bool hasDirty = false;
+    characterStore.Integrate( deltaTime );
     for ( Int32 i = 0; i < maxUserCount; i++ )
     {
-        PlayerCharacter& character = characters[ i ];
         PlayerController& controller = players[ i ];
-        character.Update( deltaTime );
+        dirtyEntities[ i ] = controller.UpdateLocationDirty() || isKeyframe;
+        if ( !dirtyEntities[ i ] ) continue;
+        hasDirty = true;
         controller.BroadcastObjectLocation( false );
     }
+    if ( hasDirty )
+    {
+        BroadcastWorldSnapshot();
+        SendDeltaSnapshots( deltaTime );
+    }
+    snapshotTick++;
+}
+
+
+void Game::Room::BroadcastWorldSnapshot()
+{
+    //  2 ÷̾Դ  ü ġ  Ŷ ϴ.
+    if ( std::none_of( players.begin(),
+                      players.end(),
+                      []( const PlayerController& player )
+                      {
+                          return player.GetProtocolVersion() == Packet::ProtocolVersion2;
+                      }
+                     ) )
+        return;
+
+    // ٲ ĳ͸ ϴ,    ο  ̸  ĳ͵ Բ   ʰ մϴ.
+    Bool isSuperseding = std::any_of( players.begin(),
+                                      players.end(),
+                                      []( const PlayerController& player )
+                                      {
+                                          return player.GetProtocolVersion() == Packet::ProtocolVersion2 &&
+                                                 player.IsStatePending( Packet::EType::ServerWorldSnapshot, 0 );
+                                      }
+                                     );
+    snapshotEntities = isSuperseding ? snapshotEntities | dirtyEntities : dirtyEntities;
+    Int32 entityCount = static_cast< Int32 >( snapshotEntities.count() );
+    UInt64 size = sizeof( Packet::Server::WorldSnapshot ) + sizeof( Packet::Server::WorldSnapshotEntity ) * entityCount;
+    snapshotBuffer.resize( size );
+    Packet::Server::WorldSnapshot packet;
+    packet.header.Size = static_cast< UInt16 >( size );
+    packet.tick = snapshotTick;
+    packet.entityCount = static_cast< Byte >( entityCount );
+    memcpy( snapshotBuffer.data(), &packet, sizeof( packet ) );
+    Packet::Server::WorldSnapshotEntity* entity = reinterpret_cast< Packet::Server::WorldSnapshotEntity* >( snapshotBuffer.data() + sizeof( packet ) );
+    for ( Int32 i = 0; i < maxUserCount; i++ )
+    {
+        if ( !snapshotEntities[ i ] ) continue;
+        SimulationVector location = characters[ i ].GetLocation();
+        SimulationVector forward = characters[ i ].GetForward();
+        entity->targetIndex = static_cast< Byte >( i );
+        entity->chracterState = static_cast< Byte >( players[ i ].GetState() );
+        entity->locationX = static_cast< Single >( location.x );
+        entity->locationY = static_cast< Single >( location.y );
+        entity->forwardX = static_cast< Single >( forward.x );
+        entity->forwardY = static_cast< Single >( forward.y );
+        entity++;
+    }
+    BroadcastUnreliableByte( snapshotBuffer.data(), static_cast< UInt32 >( size ), Packet::ProtocolVersion2, 0 );
+}
+
+
+void Game::Room::SendDeltaSnapshots( Double deltaTime )
+{
+    //  3 ÷̾  Ȯ   Ÿ  ϴ.
+    Bool isCaptured = false;
+    for ( Int32 i = 0; i < maxUserCount; i++ )
+    {
+        if ( players[ i ].GetProtocolVersion() < Packet::ProtocolVersion3 ) continue;
+        if ( !isCaptured )
+        {
+            snapshotEncoder.BeginCapture( snapshotTick );
+            for ( Int32 j = 0; j < maxUserCount; j++ )
+            {
+                snapshotEncoder.CaptureEntity( j,
+                                              players[ j ].GetState(),
+                                              characters[ j ].GetLocation(),
+                                              characters[ j ].GetForward(),
+                                              characters[ j ].GetFinalSpeed()
+                                             );
+            }
+            isCaptured = true;
+        }
+        UInt64 size = snapshotEncoder.Encode( snapshotAckedTicks[ i ], snapshotBuffer );
+        players[ i ].SendStateByte( snapshotBuffer.data(), size, 0 );
+
+        snapshotStatistics.deltaBytes += size;
+        snapshotStatistics.objectLocationBytes += sizeof( Packet::Server::ObjectLocation ) * maxUserCount;
+        snapshotStatistics.playerSeconds += deltaTime;
+    }
+}
+
+
+void Game::Room::OnSnapshotAcked( Int32 playerIndex, UInt32 tick )
+{
+    //   ִ ƽ   ο ͸  ϴ.
+    if ( !snapshotEncoder.HasTick( tick ) ) return;
+    UInt32& ackedTick = snapshotAckedTicks[ playerIndex ];
+    if ( ackedTick == SnapshotEncoder::NullTick || tick > ackedTick ) ackedTick = tick;
+}
+
+
+Game::SnapshotStatistics Game::Room::TakeSnapshotStatistics()
+{
+    SnapshotStatistics statistics = snapshotStatistics;
+    snapshotStatistics = SnapshotStatistics();
+    return statistics;
 }
 
 
@@ -205,10 +397,11 @@ void Game::Room::CheckStateChange()
         }
         SetState( ERoomState::End );
         LogLine( "End of Game" );
+        FlushStateChanges();
         BroadcastEndGame();
-        for ( Network::Session* i : sessions )
+        for ( Network::SessionHandle handle : sessions )
         {
-            i->ClearRoomData();
+            if ( Network::Session* session = FindSession( handle ) ) session->ClearRoomData();
         }
     }
 }
@@ -217,30 +410,57 @@ void Game::Room::CheckStateChange()
 void Game::Room::Update( Double deltaTime )
 {
     if ( state == ERoomState::End ) return;
+#ifdef SIMULATION_FIXED_POINT
+    // ð     ؼ  Է̸  Ⱑ ǰ մϴ.
+    deltaTime = FixedSimulationStepSeconds;
+    simulationTime += std::chrono::duration< Double >( deltaTime );
+#endif
+    EnterSimulationClock();
+    ALLOCATION_PHASE( RoomMap );
     UpdateMap();
+    ALLOCATION_PHASE( RoomPlayerController );
     UpdatePlayerController( deltaTime );
+    ALLOCATION_PHASE( RoomCharacter );
     UpdateCharacter( deltaTime );
-    CheckCollision( deltaTime );
+    ALLOCATION_PHASE( RoomCollision );
+    ( this->*kernel->checkCollision )( deltaTime );
+    ALLOCATION_PHASE( RoomItem );
     UpdateItem( deltaTime );
-    CheckNewKing();
+    ALLOCATION_PHASE( RoomKing );
+    ( this->*kernel->checkNewKing )();
+    ALLOCATION_PHASE( RoomStateChange );
     CheckStateChange();
+    FlushStateChanges();
+    ALLOCATION_PHASE( UpdateRooms );
+}
+
+
+void Game::Room::FlushStateChanges()
+{
+    for ( Int32 i = 0; i < maxUserCount; i++ )
+    {
+        players[ i ].FlushStateChangedPacket();
+    }
 }
 
 
 void Game::Room::ReadyToGame()
 {
+    EnterSimulationClock();
     Packet::Server::StartMatch packet;
     packet.userCount = maxUserCount;
     for ( Int32 i = 0; i < maxUserCount; i++ )
     {
         packet.playerIndex = i; // ӽ
         players[ i ].SendPacket( &packet );
+        if ( Network::Session* session = FindSession( sessions[ i ] ) ) session->OpenUnreliableChannel();
     }
     for ( Int32 i = 0; i < maxUserCount; i++ )
     {
         players[ i ].BroadcastObjectLocation( true );
         players[ i ].Initialize();
     }
+    FlushStateChanges();
     SetState( ERoomState::Waited );
     LogLine( "Ready of Game" );
     startTime.SetNow().AddSeconds( Constant::GameFirstWaitSeconds );
@@ -248,6 +468,41 @@ void Game::Room::ReadyToGame()
 }
 
 
+void Game::Room::SeedRandom( UInt32 seed )
+{
+    random.seed( seed );
+}
+
+
+void Game::Room::EnterSimulationClock() const
+{
+    //   Ÿ̸Ӹ   θϴ,  Ҽ 尡 ƴϸ ð踦 ״ ϴ.
+#ifdef SIMULATION_FIXED_POINT
+    Timer::SimulationNow() = simulationTime;
+#endif
+}
+
+
+void Game::Room::MuteLog( Bool isMuted )
+{
+    isLogMuted = isMuted;
+}
+
+
+Bool Game::Room::IsLogMuted() const
+{
+    return isLogMuted;
+}
+
+
+void Game::Room::SkipSeconds( Double seconds )
+{
+    //  ð踦 մϴ,   ġũ  ð    ƽ   ϴ.
+    startTime.AddSeconds( -seconds );
+    itemSpawnedTime.AddSeconds( -seconds );
+}
+
+
 void Game::Room::BroadcastByte( const Byte* data, UInt32 size )
 {
     BroadcastByteInternal( data, size, nullptr );
@@ -260,9 +515,21 @@ void Game::Room::BroadcastByte( const Byte* data, UInt32 size, Int32 expectedUse
 }
 
 
+void Game::Room::BroadcastUnreliableByte( const Byte* data, UInt32 size, Byte version, Int32 stateKey )
+{
+    // data  version   ְ, ش  ÷̾Ը ϴ.
+    // UDP   ÷̾ UDP ,  Ǹ ֽ ͸  TCP   ϴ.
+    for ( PlayerController& player : players )
+    {
+        if ( player.GetProtocolVersion() != version ) continue;
+        player.SendStateByte( data, size, stateKey );
+    }
+}
+
+
 bool Game::Room::CheckCollisionTwoPlayer( PlayerCharacter& firstChr, Game::PlayerController& firstCon, Game::PlayerCharacter& secondChr, Game::PlayerController& secondCon, Double deltaTime )
 {
-    Double penetration = 0.0;
+    SimulationNum penetration = SimulationNum( 0 );
     bool isCollide = IsCollide( firstChr, secondChr, penetration );
     bool isLastCollided = firstChr.GetColliderFillter( firstChr ) || secondChr.GetColliderFillter( firstChr );
     //if( isCollide )
@@ -292,7 +559,7 @@ bool Game::Room::CheckCollisionTwoPlayer( PlayerCharacter& firstChr, Game::Playe
 }
 
 
-void Game::Room::ResolveCollision( PlayerCharacter& firstChr, PlayerCharacter& secondChr, Double deltaTime, Double penetration )
+void Game::Room::ResolveCollision( PlayerCharacter& firstChr, PlayerCharacter& secondChr, Double deltaTime, SimulationNum penetration )
 {
     auto& a = firstChr;
     auto& b = secondChr;
@@ -303,27 +570,29 @@ void Game::Room::ResolveCollision( PlayerCharacter& firstChr, PlayerCharacter& s
     firstChr.SetLocation( firstChr.GetLocation() - normal * penetration * 0.505f );
     secondChr.SetLocation( secondChr.GetLocation() + normal * penetration * 0.505f );
 
-    Double velAlongNormal = Vector::Dot( rv, normal );
-    if ( velAlongNormal > 0 ) return;
+    // ݷ SimulationNum θ ؼ Fixed 忡  길 ϴ.
+    const SimulationNum one = SimulationNum( 1 );
+    SimulationNum velAlongNormal = SimulationVector::Dot( rv, normal );
+    if ( velAlongNormal > SimulationNum( 0 ) ) return;
 
-    Double e = Constant::CharacterElasticity; // ź 
-    Double j = -( 1 + e ) * velAlongNormal;
+    SimulationNum e = SimulationNum( Constant::CharacterElasticity ); // ź 
+    SimulationNum j = -( one + e ) * velAlongNormal;
 
-    Double AMass = firstChr.GetWeight();
-    Double BMass = secondChr.GetWeight();
-    j /= 1 / AMass + 1 / BMass;
+    SimulationNum AMass = firstChr.GetWeight();
+    SimulationNum BMass = secondChr.GetWeight();
+    j /= one / AMass + one / BMass;
     auto impulse = normal * j;
-    Vector aNewSpeed = ( impulse / AMass );
+    SimulationVector aNewSpeed = ( impulse / AMass );
     a.AddSpeed( aNewSpeed );
     a.ClampSpeed( Constant::CharacterMaxSpeed );
-    Vector bNewSpeed = -( impulse / BMass );
+    SimulationVector bNewSpeed = -( impulse / BMass );
     b.AddSpeed( bNewSpeed );
     b.ClampSpeed( Constant::CharacterMaxSpeed );
-    printf( "Collision by A[%lf,%lf,%lf] / B[%lf,%lf,%lf] / penetraion : %lf\n", aNewSpeed.x, aNewSpeed.y, aNewSpeed.z, bNewSpeed.x, bNewSpeed.y, bNewSpeed.z, penetration );
+    if ( !isLogMuted ) printf( "Collision by A[%lf,%lf] / B[%lf,%lf] / penetraion : %lf\n", static_cast< Double >( aNewSpeed.x ), static_cast< Double >( aNewSpeed.y ), static_cast< Double >( bNewSpeed.x ), static_cast< Double >( bNewSpeed.y ), static_cast< Double >( penetration ) );
 }
 
 
-void Game::Room::ResolveSpawnCollision( PlayerCharacter& spawnCharacter, PlayerCharacter& other, Double deltaTime, Double penetration )
+void Game::Room::ResolveSpawnCollision( PlayerCharacter& spawnCharacter, PlayerCharacter& other, Double deltaTime, SimulationNum penetration )
 {
     auto& a = spawnCharacter;
     auto& b = other;
@@ -337,36 +606,86 @@ void Game::Room::CheckCollision( Double deltaTime )
 {
     for ( Int32 first = 0; first < maxUserCount; first++ )
     {
-        PlayerCharacter& firstChr = characters[ first ];
-        PlayerController& firstCon = players[ first ];
         for ( Int32 second = first + 1; second < maxUserCount; second++ )
         {
-            PlayerCharacter& secondChr = characters[ second ];
-            PlayerController& secondCon = players[ second ];
-            bool isCollide = CheckCollisionTwoPlayer( 
-                firstChr, firstCon,
-                secondChr, secondCon,
-                deltaTime );
-            if ( isCollide )
-            {
-                firstCon.OnCollided( secondCon );
-                secondCon.OnCollided( firstCon );
-            }
-        }
-        bool isOutOfMap = firstChr.GetLocation().GetLength() > currentMapSize;
-        if ( isOutOfMap && firstCon.GetState() != EPlayerState::Die )
-        {
-            firstCon.ChangeState( EPlayerState::Die );
-            OnDiePlayer( &firstCon );
+            CheckCollisionPair( first, second, deltaTime );
         }
+        CheckOutOfMap( first );
+    }
+}
+
+
+template < Int32 PlayerCount >
+void Game::Room::CheckCollisionOf( Double deltaTime )
+{
+    // CheckCollision    ¦ ˻ϵ, ο   ־ ݺ  Ĩϴ.
+    CheckCollisionRows< PlayerCount >( deltaTime, std::make_integer_sequence< Int32, PlayerCount >() );
+}
+
+
+template < Int32 PlayerCount, Int32... Firsts >
+void Game::Room::CheckCollisionRows( Double deltaTime, std::integer_sequence< Int32, Firsts... > )
+{
+    ( ( CheckCollisionPairs< Firsts >( deltaTime, std::make_integer_sequence< Int32, PlayerCount - Firsts - 1 >() ),
+        CheckOutOfMap( Firsts ) ), ... );
+}
+
+
+template < Int32 First, Int32... Offsets >
+void Game::Room::CheckCollisionPairs( Double deltaTime, std::integer_sequence< Int32, Offsets... > )
+{
+    ( CheckCollisionPair( First, First + 1 + Offsets, deltaTime ), ... );
+}
+
+
+void Game::Room::CheckCollisionPair( Int32 first, Int32 second, Double deltaTime )
+{
+    PlayerController& firstCon = players[ first ];
+    PlayerController& secondCon = players[ second ];
+    bool isCollide = CheckCollisionTwoPlayer( 
+        characters[ first ], firstCon,
+        characters[ second ], secondCon,
+        deltaTime );
+    if ( isCollide )
+    {
+        firstCon.OnCollided( secondCon );
+        secondCon.OnCollided( firstCon );
     }
 }
 
 
-bool Game::Room::IsCollide( const PlayerCharacter& firstChr, const PlayerCharacter& secondChr, Double& resultPenetration )
+void Game::Room::CheckOutOfMap( Int32 index )
 {
-    Double dist = Vector::Distance( firstChr.GetLocation(), secondChr.GetLocation() );
-    Double sumRadius = firstChr.GetRadius() + secondChr.GetRadius();
+    PlayerController& controller = players[ index ];
+    bool isOutOfMap = characters[ index ].GetLocation().GetLength() > SimulationNum( currentMapSize );
+    if ( isOutOfMap && controller.GetState() != EPlayerState::Die )
+    {
+        controller.ChangeState( EPlayerState::Die );
+        OnDiePlayer( &controller );
+    }
+}
+
+
+const Game::Room::PlayerCountKernel* Game::Room::SelectKernel( Int32 userCount, Bool isSpecialized )
+{
+    // 1~4   ο  ģ Լ,  maxUserCount   Լ ϴ.
+    static_assert( MaxPlayerCount == 4, "ο  Լ ǥ MaxPlayerCount   մϴ" );
+    static constexpr PlayerCountKernel genericKernel = { &Room::CheckCollision, &Room::CheckNewKing };
+    static constexpr PlayerCountKernel specializedKernels[ MaxPlayerCount ] = {
+        { &Room::CheckCollisionOf< 1 >, &Room::CheckNewKingOf< 1 > },
+        { &Room::CheckCollisionOf< 2 >, &Room::CheckNewKingOf< 2 > },
+        { &Room::CheckCollisionOf< 3 >, &Room::CheckNewKingOf< 3 > },
+        { &Room::CheckCollisionOf< 4 >, &Room::CheckNewKingOf< 4 > },
+    };
+    if ( !isSpecialized || userCount < 1 || userCount > MaxPlayerCount ) return &genericKernel;
+    return &specializedKernels[ userCount - 1 ];
+}
+
+
+bool Game::Room::IsCollide( const PlayerCharacter& firstChr, const PlayerCharacter& secondChr, SimulationNum& resultPenetration )
+{
+    SimulationNum dist = SimulationVector::Distance( firstChr.GetLocation(), secondChr.GetLocation() );
+    SimulationNum sumRadius = firstChr.GetRadius() + secondChr.GetRadius();
     resultPenetration = sumRadius - dist;
     return sumRadius > dist;
 }
@@ -374,18 +693,30 @@ bool Game::Room::IsCollide( const PlayerCharacter& firstChr, const PlayerCharact
 
 bool Game::Room::IsCollide( const PlayerCharacter& character, const Item& item )
 {
-    Double dist = Vector::Distance( character.GetLocation(), item.GetLocation() );
-    Double sumRadius = character.GetRadius() + item.GetRadius();
+    SimulationNum dist = SimulationVector::Distance( character.GetLocation(), item.GetLocation() );
+    SimulationNum sumRadius = character.GetRadius() + SimulationNum( item.GetRadius() );
     return sumRadius > dist;
 }
 
 
 void Game::Room::BroadcastByteInternal( const Byte* data, UInt32 size, PlayerController* expectedUser )
 {
+    //    ӿ ,  ÷̾Դ  ѱϴ.
+    Network::SendFrame* frames[ Packet::LatestProtocolVersion + 1 ] = {};
     for ( PlayerController& player : players )
     {
         if ( &player == expectedUser ) continue;
-        player.SendByte( data, size );
+        Byte version = player.GetProtocolVersion();
+        if ( frames[ version ] == nullptr )
+        {
+            frames[ version ] = Network::SendFramePool::Acquire();
+            frames[ version ]->AppendPacket( data, size, version );
+        }
+        player.SendSharedFrame( frames[ version ] );
+    }
+    for ( Network::SendFrame* frame : frames )
+    {
+        Network::SendFramePool::Release( frame );
     }
 }
 
@@ -421,10 +752,10 @@ void Game::Room::BroadcastSpawnItem( const Item& item )
     Packet::Server::ItemSpawn packet;
     packet.itemIndex = item.GetIndex();
     packet.itemType = static_cast< Byte >( item.GetType() );
-    Vector location = item.GetLocation();;
-    packet.locationX = location.x;
-    packet.locationY = location.y;
-    packet.locationZ = location.z;
+    SimulationVector location = item.GetLocation();;
+    packet.locationX = static_cast< Single >( location.x );
+    packet.locationY = static_cast< Single >( location.y );
+    packet.locationZ = 0.0f;
     BroadcastPacket( &packet );
 }
 
@@ -440,6 +771,7 @@ void Game::Room::BroadcastRemoveItem( const Item& item, bool isEaten )
 
 void Game::Room::LogLine( const char* format, ... ) const
 {
+    if ( isLogMuted ) return;
     time_t c;
     time( &c );
     tm t;
@@ -453,7 +785,7 @@ void Game::Room::LogLine( const char* format, ... ) const
 }
 
 
-Game::Vector Game::Room::GetSpawnLocation( UInt32 index ) const
+Game::SimulationVector Game::Room::GetSpawnLocation( UInt32 index ) const
 {
     Double currentSize = currentMapSize;
     if( startTime.IsOverSeconds( Constant::MapFirstDisableSeconds - 5 ) ) currentSize = Constant::MapFirstDisableSize;
@@ -462,15 +794,15 @@ Game::Vector Game::Room::GetSpawnLocation( UInt32 index ) const
 
     Double angle = 360.0 * ( static_cast< Double >( index + 1 ) / static_cast< Double >( maxUserCount ) );
     Double spawnLength = Constant::MapSpawnPointRatio * currentSize;
-    Vector spawnPoint = Vector( 0.0, -spawnLength, 0.0 ).Rotated2D( angle );
+    SimulationVector spawnPoint = SimulationVector( 0.0, -spawnLength ).Rotated2D( angle );
     return spawnPoint;
 }
 
 
-Game::Vector Game::Room::GetSpawnForward( UInt32 index ) const
+Game::SimulationVector Game::Room::GetSpawnForward( UInt32 index ) const
 {
-    Vector start = GetSpawnLocation( index );
-    Vector end = Vector( 0 );
+    SimulationVector start = GetSpawnLocation( index );
+    SimulationVector end = SimulationVector( 0 );
     return ( end - start ).Normalized();
 }
 
@@ -481,6 +813,42 @@ Game::ERoomState Game::Room::GetState() const
 }
 
 
+const std::array< Int32, Game::MaxPlayerCount >& Game::Room::GetScores() const
+{
+    return scores;
+}
+
+
+#ifdef SIMULATION_FIXED_POINT
+UInt64 Game::Room::GetStateHash() const
+{
+    // , ƽ  ĳ͸ , ġ,   Ҽ  FNV-1a  ϴ.  Ƿ  忡 ϴ.
+    UInt64 hash = 14695981039346656037ULL;
+    auto mix = [&hash]( Int64 value )
+    {
+        for ( Int32 i = 0; i < 8; i++ )
+        {
+            hash ^= static_cast< UInt64 >( value >> ( i * 8 ) ) & 0xff;
+            hash *= 1099511628211ULL;
+        }
+    };
+    mix( snapshotTick );
+    for ( Int32 i = 0; i < maxUserCount; i++ )
+    {
+        SimulationVector location = characters[ i ].GetLocation();
+        SimulationVector forward = characters[ i ].GetForward();
+        mix( scores[ i ] );
+        mix( static_cast< Int64 >( players[ i ].GetState() ) );
+        mix( location.x.raw );
+        mix( location.y.raw );
+        mix( forward.x.raw );
+        mix( forward.y.raw );
+    }
+    return hash;
+}
+#endif
+
+
 void Game::Room::SetState( ERoomState state )
 {
     this->state = state;
@@ -501,58 +869,65 @@ void Game::Room::CheckNewKing()
     if( !shouldCheckKing ) return;
     if( !startTime.IsOverSeconds( Constant::MapFirstDisableSeconds ) ) return;
     Int32 maxScore = -1;
+    PlayerMask maxUsers;
 
     LogLine( "CheckNewKing" );
     for ( Int32 i = 0; i < maxUserCount; ++i )
     {
         if ( maxScore < scores[ i ] )
         {
-            maxUsers.clear();
+            maxUsers.reset();
             maxScore = scores[ i ];
-            maxUsers.insert( i );
+            maxUsers.set( i );
         }
         else if ( maxScore == scores[ i ] )
         {
-            maxUsers.insert( i );
+            maxUsers.set( i );
         }
     }
+    UpdateKing( maxUsers, maxUserCount );
+}
+
+
+template < Int32 PlayerCount >
+void Game::Room::CheckNewKingOf()
+{
+    if( !shouldCheckKing ) return;
+    if( !startTime.IsOverSeconds( Constant::MapFirstDisableSeconds ) ) return;
+
+    LogLine( "CheckNewKing" );
+    UpdateKing( GetMaxScoreUsers( std::make_integer_sequence< Int32, PlayerCount >() ), PlayerCount );
+}
+
 
-    if( maxUsers.size( ) == maxUserCount )
+template < Int32... Indices >
+Game::PlayerMask Game::Room::GetMaxScoreUsers( std::integer_sequence< Int32, Indices... > ) const
+{
+    Int32 maxScore = std::max( { scores[ Indices ]... } );
+    PlayerMask maxUsers;
+    ( maxUsers.set( Indices, scores[ Indices ] == maxScore ), ... );
+    return maxUsers;
+}
+
+
+void Game::Room::UpdateKing( PlayerMask maxUsers, Int32 playerCount )
+{
+    //     ϴ.
+    if ( static_cast< Int32 >( maxUsers.count() ) == playerCount ) maxUsers.reset();
+    for( Int32 i = 0; i < playerCount; ++i )
     {
-        for( Int32 i = 0; i < maxUserCount; ++i )
+        if( kingUsers[ i ] && !maxUsers[ i ] )
         {
-            if( prevMaxUsers.count( i ) )
-            {
-                players[i].RemoveKing( );
-            }
+            players[i].RemoveKing( );
         }
-        maxUsers.clear();
-    }
-    else
-    {
-        for( Int32 i = 0; i < maxUserCount; ++i )
+        else if( !kingUsers[ i ] && maxUsers[ i ] )
         {
-            if( prevMaxUsers.count( i ) )
-            {
-                if( !maxUsers.count( i ) )
-                {
-                    players[i].RemoveKing( );
-                }
-            }
-            else
-            {
-                if( maxUsers.count( i ) )
-                {
-                    players[i].ApplyKing( );
-                }
-            }
+            players[i].ApplyKing( );
         }
     }
 
     shouldCheckKing = false;
-    prevMaxUsers.clear();
-    prevMaxUsers = std::move( maxUsers );
-    maxUsers.clear();
+    kingUsers = maxUsers;
 }
 
 
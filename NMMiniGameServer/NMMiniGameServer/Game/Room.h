@@ -13,32 +13,71 @@
 #include "Game/Item.h"
 #include "Game/PlayerController.h"
 #include "Game/PlayerCharacter.h"
+#include "Game/RoomArena.h"
 #include "Game/RoomState.h"
+#include "Game/SnapshotEncoder.h"
+#include <array>
+#include <bitset>
+#include <memory_resource>
+#include <optional>
+#include <random>
+#include <utility>
 #include <vector>
-#include <set>
 
 
 namespace Network
 {
     class Session;
+    class Server;
 };
 
 
 namespace Game
 {
+    //   ִ ο, Ŷ scores[ 4 ]  ƾ մϴ.
+    constexpr Int32 MaxPlayerCount = 4;
+    using PlayerMask = std::bitset< MaxPlayerCount >;
+#ifdef SIMULATION_FIXED_POINT
+    //  Ҽ  ƽ , ð  ƽ ̸ŭ մϴ.
+    //     ٲ ʵ Ϻη TickTerm   ʾҽϴ, TickTerm  ٸ  ӵ ׸ŭ ޶ϴ.
+    constexpr Int32 FixedSimulationTicksPerSecond = 60;
+    constexpr Double FixedSimulationStepSeconds = 1.0 / FixedSimulationTicksPerSecond;
+#endif
 
     class Room
     {
     private:
+        //  ߿  ̳, Reset  °   arena   ޸𸮸   մϴ.
+        struct MatchData
+        {
+            std::pmr::vector< Item > items;
+            explicit MatchData( std::pmr::memory_resource* resource );
+        };
+
+        // ο    浹,  ˻ Լ,      ϴ.
+        struct PlayerCountKernel
+        {
+            void ( Room::*checkCollision )( Double deltaTime );
+            void ( Room::*checkNewKing )();
+        };
+
+        RoomArena arena; // Ʒ ̳ʺ   ߿  մϴ
         Int32 currentUserCount = 0;
         const Int32 maxUserCount = 0;
         std::vector< PlayerController > players;
+        CharacterStore characterStore; // characters  ġ, ӵ,  
         std::vector< PlayerCharacter > characters;
-        std::vector< Network::Session* > sessions;
-        std::vector< Int32 > scores;
-        std::set< Int32 > prevMaxUsers;
-        std::set< Int32 > maxUsers;
-        std::list<Item> items;
+        std::array< Network::SessionHandle, MaxPlayerCount > sessions;
+        Network::Server* server = nullptr;
+        std::array< Int32, MaxPlayerCount > scores = {};
+        const PlayerCountKernel* kernel = nullptr;
+        PlayerMask kingUsers; //  ˻翡   ÷̾
+        std::minstd_rand random; //  , ġ,  ϴ   
+        Bool isLogMuted = false; // ġũ  ܼ  ð  ʵ α׸ ϴ
+#ifdef SIMULATION_FIXED_POINT
+        Timer::TimePoint simulationTime; //  ۺ  θ Ѿ ð
+#endif
+        std::optional< MatchData > match;
         Timer startTime;
         Timer itemSpawnedTime;
         ERoomState state;
@@ -46,13 +85,31 @@ namespace Game
         Double currentMapSize = 0;
         Int32 mapPhase = 0;
         bool shouldCheckKing = true;
+        UInt32 snapshotTick = 0;
+        std::vector< Byte > snapshotBuffer;
+        SnapshotEncoder snapshotEncoder;
+        std::array< UInt32, MaxPlayerCount > snapshotAckedTicks;
+        SnapshotStatistics snapshotStatistics;
+        PlayerMask dirtyEntities;
+        PlayerMask snapshotEntities; //  WorldSnapshot   ĳ,   ٽ ϴ
     public:
-        Room( Int32 userCount );
+        Room( Int32 userCount, Network::Server* server, Bool isSpecialized = true );
         ~Room() = default;
+        void Reset();
         void AddSession( Int32 index, Network::Session* session );
+        void AddScriptedPlayer( Int32 index );
+        void OnScriptedInput( Int32 index, const Packet::Client::Input& input );
+        Network::Session* FindSession( Network::SessionHandle handle ) const;
         void Update( Double deltaTime );
 
         void ReadyToGame();
+        void SkipSeconds( Double seconds );
+        void SeedRandom( UInt32 seed );
+        void MuteLog( Bool isMuted );
+        Bool IsLogMuted() const;
+        void EnterSimulationClock() const;
+        void OnSnapshotAcked( Int32 playerIndex, UInt32 tick );
+        SnapshotStatistics TakeSnapshotStatistics();
 
         template < class PacketType >
         void BroadcastPacket( const PacketType* buffer );
@@ -60,22 +117,46 @@ namespace Game
         template < class PacketType >
         void BroadcastPacket( const PacketType* buffer, Int32 expectedUserIndex );
 
+        template < class PacketType >
+        void BroadcastUnreliablePacket( const PacketType* buffer, Byte version, Int32 stateKey );
+
         void BroadcastByte( const Byte* data, UInt32 size );
         void BroadcastByte( const Byte* data, UInt32 size, Int32 expectedUserIndex );
+        void BroadcastUnreliableByte( const Byte* data, UInt32 size, Byte version, Int32 stateKey );
         bool CheckCollisionTwoPlayer( PlayerCharacter& firstChr, PlayerController& firstCon, PlayerCharacter& secondChr, PlayerController& secondCon, Double deltaTime );
-        void ResolveCollision( PlayerCharacter& firstChr, PlayerCharacter& secondChr, Double deltaTime, Double penetration );
-        void ResolveSpawnCollision( PlayerCharacter& spawnCharacter, PlayerCharacter& other, Double deltaTime, Double penetration );
-        Vector GetSpawnLocation( UInt32 index ) const;
-        Vector GetSpawnForward( UInt32 index ) const;
+        void ResolveCollision( PlayerCharacter& firstChr, PlayerCharacter& secondChr, Double deltaTime, SimulationNum penetration );
+        void ResolveSpawnCollision( PlayerCharacter& spawnCharacter, PlayerCharacter& other, Double deltaTime, SimulationNum penetration );
+        SimulationVector GetSpawnLocation( UInt32 index ) const;
+        SimulationVector GetSpawnForward( UInt32 index ) const;
         ERoomState GetState() const;
+        const std::array< Int32, MaxPlayerCount >& GetScores() const;
+#ifdef SIMULATION_FIXED_POINT
+        UInt64 GetStateHash() const;
+#endif
         void SetState( ERoomState state );
         void BroadcastKillLogPacket( Int32 playerIndex, Int32 killerIndex );
         void CheckNewKing();
         void OnDiePlayer( const PlayerController* player );
     private:
         void CheckCollision( Double deltaTime );
-
-        static bool IsCollide( const PlayerCharacter& firstChr, const PlayerCharacter& secondChr, Double& resultPenetration );
+        void CheckCollisionPair( Int32 first, Int32 second, Double deltaTime );
+        void CheckOutOfMap( Int32 index );
+        void UpdateKing( PlayerMask maxUsers, Int32 playerCount );
+
+        template < Int32 PlayerCount >
+        void CheckCollisionOf( Double deltaTime );
+        template < Int32 PlayerCount, Int32... Firsts >
+        void CheckCollisionRows( Double deltaTime, std::integer_sequence< Int32, Firsts... > );
+        template < Int32 First, Int32... Offsets >
+        void CheckCollisionPairs( Double deltaTime, std::integer_sequence< Int32, Offsets... > );
+        template < Int32 PlayerCount >
+        void CheckNewKingOf();
+        template < Int32... Indices >
+        PlayerMask GetMaxScoreUsers( std::integer_sequence< Int32, Indices... > ) const;
+
+        static const PlayerCountKernel* SelectKernel( Int32 userCount, Bool isSpecialized );
+
+        static bool IsCollide( const PlayerCharacter& firstChr, const PlayerCharacter& secondChr, SimulationNum& resultPenetration );
         static bool IsCollide( const PlayerCharacter& character, const Item& item );
 
         void BroadcastByteInternal( const Byte* data, UInt32 size, PlayerController* expectedUser );
@@ -84,10 +165,13 @@ namespace Game
         void BroadcastMapSizeChanged( Int32 mapIndex );
         void BroadcastSpawnItem( const Item& item );
         void BroadcastRemoveItem( const Item& item, bool isEaten );
+        void BroadcastWorldSnapshot();
+        void SendDeltaSnapshots( Double deltaTime );
+        void FlushStateChanges();
         void LogLine( const char* format, ... ) const;
-        PlayerController* GetNewPlayerController( Int32 index, Network::Session* session );
+        PlayerController* GetNewPlayerController( Int32 index, Network::SessionHandle session );
         void SpawnItem();
-        Vector GetRandomItemLocation() const;
+        SimulationVector GetRandomItemLocation();
         void CheckCollisionItem();
 
         void UpdatePlayerController( Double deltaTime );
@@ -112,4 +196,11 @@ namespace Game
     {
         BroadcastByte( reinterpret_cast< const Byte* >( buffer ), sizeof( PacketType ), expectedUserIndex );
     }
+
+
+    template < class PacketType >
+    void Room::BroadcastUnreliablePacket( const PacketType* buffer, Byte version, Int32 stateKey )
+    {
+        BroadcastUnreliableByte( reinterpret_cast< const Byte* >( buffer ), sizeof( PacketType ), version, stateKey );
+    }
 }
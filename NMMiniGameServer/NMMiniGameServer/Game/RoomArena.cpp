@@ -0,0 +1,92 @@
+﻿// =================================================================================================
+//  @file RoomArena.cpp
+// 
+//  @brief 방 하나가 쓰는 컨테이너 메모리를 방 슬롯 수명과 경기 수명으로 나눠 관리합니다.
+//  
+//  @date 2026/10/17
+// 
+//  Copyright 2026 2022 Netmarble Neo, Inc. All Rights Reserved.
+// =================================================================================================
+
+
+#include "Game/RoomArena.h"
+#include "Game/CountingResource.h"
+#include "Network/PageMemory.h"
+
+
+namespace
+{
+    // 모든 방의 아레나가 같이 씁니다.
+    Game::CountingResource& GetUpstreamResource()
+    {
+        static Game::CountingResource resource;
+        return resource;
+    }
+
+    // ReserveMatchBuffers 로 잡아둔 덩어리를 방마다 matchBytes 씩 잘라 줍니다.
+    struct ReservedMatchBuffers
+    {
+        Byte* memory = nullptr;
+        UInt64 matchBytes = 0;
+        UInt32 count = 0;
+        UInt32 nextIndex = 0;
+    };
+
+    ReservedMatchBuffers reservedMatchBuffers;
+
+    Byte* TakeReservedMatchBuffer( UInt64 matchBytes )
+    {
+        ReservedMatchBuffers& reserved = reservedMatchBuffers;
+        if ( reserved.matchBytes != matchBytes || reserved.nextIndex >= reserved.count ) return nullptr;
+        return reserved.memory + reserved.matchBytes * reserved.nextIndex++;
+    }
+}
+
+
+Game::RoomArena::RoomArena( UInt64 matchBytes )
+    : reservedBlock( TakeReservedMatchBuffer( matchBytes ) ),
+      matchBuffer( reservedBlock ? 0 : matchBytes ),
+      roomResource( &GetUpstreamResource() ),
+      matchResource( reservedBlock ? reservedBlock : matchBuffer.data(), matchBytes, &GetUpstreamResource() ),
+      matchPool( &matchResource )
+{
+}
+
+
+std::pmr::memory_resource* Game::RoomArena::GetRoomResource()
+{
+    return &roomResource;
+}
+
+
+std::pmr::memory_resource* Game::RoomArena::GetMatchResource()
+{
+    return &matchPool;
+}
+
+
+void Game::RoomArena::ReleaseMatch()
+{
+    // 넘친 블록만 힙에 돌려주고 matchBuffer 는 다음 경기에 처음부터 다시 씁니다.
+    matchPool.release();
+    matchResource.release();
+}
+
+
+UInt64 Game::RoomArena::TakeUpstreamAllocationCount()
+{
+    return GetUpstreamResource().TakeAllocationCount();
+}
+
+
+Bool Game::RoomArena::ReserveMatchBuffers( UInt32 roomCount, UInt64 matchBytes, Bool useLargePages )
+{
+    ReservedMatchBuffers& reserved = reservedMatchBuffers;
+    if ( reserved.memory || roomCount == 0 || matchBytes == 0 ) return false;
+    Bool isLargePages = false;
+    reserved.memory = Network::PageMemory::Allocate( matchBytes * roomCount, useLargePages, isLargePages );
+    reserved.matchBytes = matchBytes;
+    reserved.count = roomCount;
+    reserved.nextIndex = 0;
+    return isLargePages;
+}
@@ -0,0 +1,43 @@
+﻿// =================================================================================================
+//  @file RoomArena.h
+// 
+//  @brief 방 하나가 쓰는 컨테이너 메모리를 방 슬롯 수명과 경기 수명으로 나눠 관리합니다.
+//  
+//  @date 2026/10/17
+// 
+//  Copyright 2026 2022 Netmarble Neo, Inc. All Rights Reserved.
+// =================================================================================================
+
+
+#pragma once
+#include "Define/DataTypes.h"
+#include <memory_resource>
+#include <vector>
+
+
+namespace Game
+{
+    // 방 슬롯 메모리 : FSM 표처럼 방을 재사용해도 그대로 두는 것, 방 객체가 사라질 때 해제됩니다.
+    // 경기 메모리 : 킹 목록, 아이템, 충돌 필터처럼 경기 중에만 쓰는 것, ReleaseMatch 로 한 번에 해제됩니다.
+    // ReleaseMatch 전에 경기 메모리를 쓰는 컨테이너를 모두 없애야 합니다.
+    class RoomArena
+    {
+    private:
+        Byte* reservedBlock; // 경기마다 처음부터 다시 쓰는 첫 블록, ReserveMatchBuffers 에서 잘라 온 것
+        std::vector< Byte > matchBuffer; // 잘라 올 블록이 없을 때 대신 쓰는 첫 블록
+        std::pmr::monotonic_buffer_resource roomResource;
+        std::pmr::monotonic_buffer_resource matchResource;
+        std::pmr::unsynchronized_pool_resource matchPool; // 경기 중에 지웠다 넣는 노드를 재사용합니다
+
+    public:
+        explicit RoomArena( UInt64 matchBytes );
+
+        std::pmr::memory_resource* GetRoomResource();
+        std::pmr::memory_resource* GetMatchResource();
+        void ReleaseMatch();
+
+        static UInt64 TakeUpstreamAllocationCount();
+        // 이후에 만드는 방 roomCount 개의 첫 블록을 한 덩어리로 미리 잡습니다, 큰 페이지로 잡혔는지 돌려줍니다.
+        static Bool ReserveMatchBuffers( UInt32 roomCount, UInt64 matchBytes, Bool useLargePages );
+    };
+};
@@ -0,0 +1,166 @@
+﻿// =================================================================================================
+//  @file SnapshotEncoder.cpp
+// 
+//  @brief 방 상태를 양자화해서 클라이언트가 확인한 스냅샷 기준으로 델타 비트 패킹합니다.
+//  
+//  @date 2026/10/17
+// 
+//  Copyright 2026 2022 Netmarble Neo, Inc. All Rights Reserved.
+// =================================================================================================
+
+
+#include "Game/SnapshotEncoder.h"
+#include "Define/MapData.h"
+#include "Define/PacketDefine.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+
+// 필드별 비트 수, 클라이언트 디코더와 맞춰야 합니다.
+constexpr Int32 StateBits = 4;
+constexpr Int32 LocationBits = 16;
+constexpr Int32 AngleBits = 12;
+constexpr Int32 VelocityBits = 16;
+constexpr Double Pi = 3.14159265358979323846;
+
+
+namespace
+{
+    // 낮은 비트부터 채워 나갑니다.
+    class BitWriter
+    {
+    private:
+        std::vector< Byte >& out;
+        UInt64 bitCount = 0;
+    public:
+        BitWriter( std::vector< Byte >& out )
+            : out( out ), bitCount( out.size() * 8 )
+        {
+        }
+
+        void Write( UInt32 value, Int32 bits )
+        {
+            for ( Int32 i = 0; i < bits; i++ )
+            {
+                if ( bitCount % 8 == 0 ) out.push_back( 0 );
+                if ( ( value >> i ) & 1 ) out.back() |= static_cast< Byte >( 1 << ( bitCount % 8 ) );
+                bitCount++;
+            }
+        }
+    };
+
+
+    UInt16 Quantize( Double value, Double range, Int32 bits )
+    {
+        // [-range, range] 를 [0, 2^bits - 1] 로
+        Double maxValue = static_cast< Double >( ( 1 << bits ) - 1 );
+        Double ratio = std::min( std::max( ( value + range ) / ( range * 2.0 ), 0.0 ), 1.0 );
+        return static_cast< UInt16 >( std::lround( ratio * maxValue ) );
+    }
+
+
+    Bool IsSameEntity( const Game::QuantizedEntity& lhs, const Game::QuantizedEntity& rhs )
+    {
+        return lhs.state == rhs.state &&
+               lhs.locationX == rhs.locationX &&
+               lhs.locationY == rhs.locationY &&
+               lhs.angle == rhs.angle &&
+               lhs.velocityX == rhs.velocityX &&
+               lhs.velocityY == rhs.velocityY;
+    }
+
+
+    void WriteField( BitWriter& writer, UInt32 value, UInt32 baseline, Int32 bits, Bool hasBaseline )
+    {
+        Bool isChanged = !hasBaseline || value != baseline;
+        writer.Write( isChanged, 1 );
+        if ( isChanged ) writer.Write( value, bits );
+    }
+};
+
+
+void Game::SnapshotEncoder::Initialize( Int32 entityCount )
+{
+    this->entityCount = entityCount;
+    history.assign( HistorySize, std::vector< QuantizedEntity >( entityCount ) );
+    historyTicks.assign( HistorySize, NullTick );
+    currentTick = NullTick;
+}
+
+
+void Game::SnapshotEncoder::Reset()
+{
+    // 기록은 남겨두고 tick 만 지워서 기준으로 쓰지 못하게 합니다.
+    std::fill( historyTicks.begin(), historyTicks.end(), NullTick );
+    currentTick = NullTick;
+}
+
+
+void Game::SnapshotEncoder::BeginCapture( UInt32 tick )
+{
+    currentTick = tick;
+    historyTicks[ tick % HistorySize ] = tick;
+}
+
+
+void Game::SnapshotEncoder::CaptureEntity( Int32 index, EPlayerState state, const SimulationVector& location, const SimulationVector& forward, const SimulationVector& velocity )
+{
+    // 맵 밖으로 떨어지는 중에도 표현되도록 맵 크기의 두 배까지 담습니다.
+    Double locationRange = Constant::MapSize * 2.0;
+    Double velocityRange = Constant::CharacterMaxSpeed * 2.0;
+    QuantizedEntity& entity = history[ currentTick % HistorySize ][ index ];
+    entity.state = static_cast< Byte >( state );
+    entity.locationX = Quantize( static_cast< Double >( location.x ), locationRange, LocationBits );
+    entity.locationY = Quantize( static_cast< Double >( location.y ), locationRange, LocationBits );
+    entity.angle = Quantize( std::atan2( static_cast< Double >( forward.y ), static_cast< Double >( forward.x ) ), Pi, AngleBits );
+    entity.velocityX = Quantize( static_cast< Double >( velocity.x ), velocityRange, VelocityBits );
+    entity.velocityY = Quantize( static_cast< Double >( velocity.y ), velocityRange, VelocityBits );
+}
+
+
+UInt64 Game::SnapshotEncoder::Encode( UInt32 ackedTick, std::vector< Byte >& out ) const
+{
+    const std::vector< QuantizedEntity >& current = history[ currentTick % HistorySize ];
+    const std::vector< QuantizedEntity >* baseline = FindBaseline( ackedTick );
+
+    Packet::Server::DeltaSnapshot packet;
+    packet.tick = currentTick;
+    packet.baselineTick = baseline ? ackedTick : NullTick;
+    packet.entityCount = static_cast< Byte >( entityCount );
+    out.resize( sizeof( packet ) );
+
+    // 엔티티마다 바뀜 비트 하나, 바뀌었으면 필드마다 바뀜 비트와 값
+    BitWriter writer( out );
+    for ( Int32 i = 0; i < entityCount; i++ )
+    {
+        const QuantizedEntity& entity = current[ i ];
+        QuantizedEntity base = baseline ? ( *baseline )[ i ] : QuantizedEntity();
+        Bool isChanged = !baseline || !IsSameEntity( entity, base );
+        writer.Write( isChanged, 1 );
+        if ( !isChanged ) continue;
+        WriteField( writer, entity.state, base.state, StateBits, baseline != nullptr );
+        WriteField( writer, entity.locationX, base.locationX, LocationBits, baseline != nullptr );
+        WriteField( writer, entity.locationY, base.locationY, LocationBits, baseline != nullptr );
+        WriteField( writer, entity.angle, base.angle, AngleBits, baseline != nullptr );
+        WriteField( writer, entity.velocityX, base.velocityX, VelocityBits, baseline != nullptr );
+        WriteField( writer, entity.velocityY, base.velocityY, VelocityBits, baseline != nullptr );
+    }
+
+    packet.header.Size = static_cast< UInt16 >( out.size() );
+    memcpy( out.data(), &packet, sizeof( packet ) );
+    return out.size();
+}
+
+
+Bool Game::SnapshotEncoder::HasTick( UInt32 tick ) const
+{
+    return tick != NullTick && historyTicks[ tick % HistorySize ] == tick;
+}
+
+
+const std::vector< Game::QuantizedEntity >* Game::SnapshotEncoder::FindBaseline( UInt32 ackedTick ) const
+{
+    if ( ackedTick == currentTick || !HasTick( ackedTick ) ) return nullptr;
+    return &history[ ackedTick % HistorySize ];
+}
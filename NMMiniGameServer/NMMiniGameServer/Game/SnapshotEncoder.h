@@ -0,0 +1,61 @@
+﻿// =================================================================================================
+//  @file SnapshotEncoder.h
+// 
+//  @brief 방 상태를 양자화해서 클라이언트가 확인한 스냅샷 기준으로 델타 비트 패킹합니다.
+//  
+//  @date 2026/10/17
+// 
+//  Copyright 2026 2022 Netmarble Neo, Inc. All Rights Reserved.
+// =================================================================================================
+
+
+#pragma once
+#include "Define/DataTypes.h"
+#include "Game/PlayerState.h"
+#include "Game/Vector.h"
+#include <vector>
+
+
+namespace Game
+{
+    // 맵 크기 기준 고정 소수점으로 바꾼 캐릭터 하나의 상태
+    struct QuantizedEntity
+    {
+        Byte state = 0;
+        UInt16 locationX = 0;
+        UInt16 locationY = 0;
+        UInt16 angle = 0;
+        UInt16 velocityX = 0;
+        UInt16 velocityY = 0;
+    };
+
+    struct SnapshotStatistics
+    {
+        UInt64 deltaBytes = 0; // 실제로 보낸 델타 스냅샷 바이트
+        UInt64 objectLocationBytes = 0; // 같은 수신자에게 ObjectLocation 으로 보냈다면 들었을 바이트
+        Double playerSeconds = 0.0; // 수신자 수 * 시간
+    };
+
+    class SnapshotEncoder
+    {
+    public:
+        static constexpr Int32 HistorySize = 32; // 확인 응답이 이보다 늦으면 전체 상태를 보냅니다
+        static constexpr UInt32 NullTick = 0xFFFFFFFF;
+
+    private:
+        Int32 entityCount = 0;
+        UInt32 currentTick = NullTick;
+        std::vector< std::vector< QuantizedEntity > > history;
+        std::vector< UInt32 > historyTicks;
+
+    public:
+        void Initialize( Int32 entityCount );
+        void Reset();
+        void BeginCapture( UInt32 tick );
+        void CaptureEntity( Int32 index, EPlayerState state, const SimulationVector& location, const SimulationVector& forward, const SimulationVector& velocity );
+        UInt64 Encode( UInt32 ackedTick, std::vector< Byte >& out ) const;
+        Bool HasTick( UInt32 tick ) const;
+    private:
+        const std::vector< QuantizedEntity >* FindBaseline( UInt32 ackedTick ) const;
+    };
+};
@@ -31,7 +31,11 @@ namespace Game
 
         Timer& SetNow()
         {
+#ifdef SIMULATION_FIXED_POINT
+            point = SimulationNow();
+#else
             point = SystemClock::now();
+#endif
             return *this;
         }
 
@@ -74,5 +78,14 @@ namespace Game
             inst.SetNow();
             return inst;
         }
+
+#ifdef SIMULATION_FIXED_POINT
+        //  Ҽ  ð   ó   ùķ̼ ð踦 нϴ.
+        static TimePoint& SimulationNow()
+        {
+            static thread_local TimePoint now;
+            return now;
+        }
+#endif
     };
 };
@@ -1,7 +1,7 @@
 //=================================================================================================
 // @file Vector.h
 //
-// @brief 3 ġ ǥ  ŬԴϴ.
+// @brief 2, 3 ġ ǥ  ŬԴϴ.
 // 
 // @date 2022/03/14
 //
@@ -11,53 +11,104 @@
 
 #pragma once
 #include "Define/DataTypes.h"
+#include "Game/Fixed.h"
 #include <cassert>
+#include <cmath>
 #include <type_traits>
-#include <math.h>
 
 
 namespace Game
 {
-    struct Vector
+    // ̳     ִ ŸԴϴ.
+    template < typename ScalarTy >
+    constexpr Bool IsVectorScalar = std::is_scalar_v< ScalarTy > || std::is_same_v< ScalarTy, Fixed >;
+
+    template < typename NumTy, Int32 Dimension >
+    struct VectorStorage;
+
+    template < typename NumTy >
+    struct VectorStorage< NumTy, 2 >
+    {
+        NumTy x = NumTy( 0 );
+        NumTy y = NumTy( 0 );
+    };
+
+    template < typename NumTy >
+    struct VectorStorage< NumTy, 3 >
     {
-        using NumType = Double;
-        NumType x = 0.0;
-        NumType y = 0.0;
-        NumType z = 0.0;
+        NumTy x = NumTy( 0 );
+        NumTy y = NumTy( 0 );
+        NumTy z = NumTy( 0 );
+    };
+
+    //  Ÿ԰    ִ Դϴ.
+    // ٸ Ÿ,  θ ٲ  ְ, 3 2 ٲٸ z  ϴ.
+    //  Fixed ̸    Fixed  ٲٰ, ٰ ȸ θ մϴ.
+    template < typename NumTy, Int32 Dimension >
+    struct VectorT : VectorStorage< NumTy, Dimension >
+    {
+        static_assert( std::is_floating_point_v< NumTy > || std::is_same_v< NumTy, Fixed >, "NumTy is not floating point or Fixed" );
+        using NumType = NumTy;
+        static constexpr Bool IsFixed = std::is_same_v< NumTy, Fixed >;
+
+
+        VectorT()
+        {
+        }
 
 
-        Vector()
+        template < typename ScalarTy, bool isValid = IsVectorScalar< ScalarTy > >
+        VectorT( ScalarTy value )
         {
+            static_assert( isValid == true, "ScalarTy is not Scalar" );
+            this->x = static_cast< NumType >( value );
+            this->y = static_cast< NumType >( value );
+            if constexpr ( Dimension == 3 ) this->z = static_cast< NumType >( value );
         }
 
 
-        template < typename ScalarTy, bool isValid = std::is_scalar_v< ScalarTy > >
-        Vector( ScalarTy value )
-            : x( static_cast< NumType >( value ) ), y( static_cast< NumType >( value ) ),
-              z( static_cast< NumType >( value ) )
+        template < typename ScalarTy, bool isValid = IsVectorScalar< ScalarTy > >
+        VectorT( ScalarTy x, ScalarTy y )
         {
             static_assert( isValid == true, "ScalarTy is not Scalar" );
+            static_assert( Dimension == 2, "VectorT( x, y ) is for 2D" );
+            this->x = static_cast< NumType >( x );
+            this->y = static_cast< NumType >( y );
         }
 
 
-        template < typename ScalarTy, bool isValid = std::is_scalar_v< ScalarTy > >
-        Vector( ScalarTy x, ScalarTy y, ScalarTy z )
-            : x( static_cast< NumType >( x ) ), y( static_cast< NumType >( y ) ), z( static_cast< NumType >( z ) )
+        template < typename ScalarTy, bool isValid = IsVectorScalar< ScalarTy > >
+        VectorT( ScalarTy x, ScalarTy y, ScalarTy z )
         {
             static_assert( isValid == true, "ScalarTy is not Scalar" );
+            static_assert( Dimension == 3, "VectorT( x, y, z ) is for 3D" );
+            this->x = static_cast< NumType >( x );
+            this->y = static_cast< NumType >( y );
+            this->z = static_cast< NumType >( z );
         }
 
 
-        template < typename ScalarTy, bool isValid = std::is_scalar_v< ScalarTy > >
-        Vector operator*( ScalarTy value ) const
+        template < typename OtherTy, Int32 OtherDimension >
+        explicit VectorT( const VectorT< OtherTy, OtherDimension >& other )
+        {
+            this->x = static_cast< NumType >( other.x );
+            this->y = static_cast< NumType >( other.y );
+            if constexpr ( Dimension == 3 && OtherDimension == 3 ) this->z = static_cast< NumType >( other.z );
+        }
+
+
+        template < typename ScalarTy, bool isValid = IsVectorScalar< ScalarTy > >
+        VectorT operator*( ScalarTy value ) const
         {
             static_assert( isValid == true, "ScalarTy is not Scalar" );
-            return Vector( x * value, y * value, z * value );
+            if constexpr ( IsFixed ) return *this * VectorT( value );
+            else if constexpr ( Dimension == 2 ) return VectorT( this->x * value, this->y * value );
+            else return VectorT( this->x * value, this->y * value, this->z * value );
         }
 
 
-        template < typename ScalarTy, bool isValid = std::is_scalar_v< ScalarTy > >
-        Vector& operator*=( ScalarTy value )
+        template < typename ScalarTy, bool isValid = IsVectorScalar< ScalarTy > >
+        VectorT& operator*=( ScalarTy value )
         {
             static_assert( isValid == true, "ScalarTy is not Scalar" );
             *this = *this * value;
@@ -65,53 +116,57 @@ namespace Game
         }
 
 
-        Vector operator+( Vector v ) const
+        VectorT operator+( VectorT v ) const
         {
-            return Vector( x + v.x, y + v.y, z + v.z );
+            if constexpr ( Dimension == 2 ) return VectorT( this->x + v.x, this->y + v.y );
+            else return VectorT( this->x + v.x, this->y + v.y, this->z + v.z );
         }
 
 
-        Vector& operator+=( Vector v )
+        VectorT& operator+=( VectorT v )
         {
             *this = *this + v;
             return *this;
         }
 
 
-        Vector operator*( Vector v ) const
+        VectorT operator*( VectorT v ) const
         {
-            return Vector( x * v.x, y * v.y, z * v.z );
+            if constexpr ( Dimension == 2 ) return VectorT( this->x * v.x, this->y * v.y );
+            else return VectorT( this->x * v.x, this->y * v.y, this->z * v.z );
         }
 
 
-        Vector& operator*=( Vector v )
+        VectorT& operator*=( VectorT v )
         {
             *this = *this * v;
             return *this;
         }
 
 
-        Vector operator-( Vector v ) const
+        VectorT operator-( VectorT v ) const
         {
-            return Vector( x - v.x, y - v.y, z - v.z );
+            if constexpr ( Dimension == 2 ) return VectorT( this->x - v.x, this->y - v.y );
+            else return VectorT( this->x - v.x, this->y - v.y, this->z - v.z );
         }
 
 
-        Vector& operator-=( Vector v )
+        VectorT& operator-=( VectorT v )
         {
             *this = *this - v;
             return *this;
         }
 
 
-        Vector operator/( Vector v ) const
+        VectorT operator/( VectorT v ) const
         {
             assert( v.IsZero( ) == false );
-            return Vector( x / v.x, y / v.y, z / v.z );
+            if constexpr ( Dimension == 2 ) return VectorT( this->x / v.x, this->y / v.y );
+            else return VectorT( this->x / v.x, this->y / v.y, this->z / v.z );
         }
 
 
-        Vector& operator/=( Vector v )
+        VectorT& operator/=( VectorT v )
         {
             assert( v.IsZero( ) == false );
             *this = *this / v;
@@ -119,7 +174,7 @@ namespace Game
         }
 
 
-        Vector operator-() const
+        VectorT operator-() const
         {
             return *this * -1.0f;
         }
@@ -127,43 +182,56 @@ namespace Game
 
         NumType GetSqr() const
         {
-            return x * x + y * y + z * z;
+            if constexpr ( Dimension == 2 ) return this->x * this->x + this->y * this->y;
+            else return this->x * this->x + this->y * this->y + this->z * this->z;
         }
 
 
         NumType GetLength() const
         {
-            return sqrt( GetSqr() );
+            if constexpr ( IsFixed ) return Fixed::Sqrt( GetSqr() );
+            else return std::sqrt( GetSqr() );
         }
 
 
-        Vector Normalized() const
+        VectorT Normalized() const
         {
             auto length = GetLength();
-            if(length == 0) return Vector::Zero();
+            if(length == NumType( 0 )) return VectorT::Zero();
             else return *this / length;
         }
 
 
-        Vector& Normalize()
+        VectorT& Normalize()
         {
             *this = this->Normalized();
             return *this;
         }
 
 
-        Vector Rotated2D( Double rotation, bool isRadian = false ) const
+        // ﰢԼ Fixed  ǥ, ƴϸ  Ÿ԰  Double  մϴ.
+        VectorT Rotated2D( Double rotation, bool isRadian = false ) const
         {
-            Double radian = isRadian ? rotation : rotation * 3.141592 / 180.0;
-            Double cosValue = cos( radian );
-            Double sinValue = sin( radian );
-            Double newX = cosValue * x - sinValue * y;
-            Double newY = sinValue * x + cosValue * y;
-            return Vector( newX, newY, z );
+            if constexpr ( IsFixed )
+            {
+                VectorT result = *this;
+                Fixed::Rotate( Fixed( isRadian ? rotation * 180.0 / 3.141592 : rotation ), result.x, result.y );
+                return result;
+            }
+            else
+            {
+                Double radian = isRadian ? rotation : rotation * 3.141592 / 180.0;
+                Double cosValue = cos( radian );
+                Double sinValue = sin( radian );
+                Double newX = cosValue * this->x - sinValue * this->y;
+                Double newY = sinValue * this->x + cosValue * this->y;
+                if constexpr ( Dimension == 2 ) return VectorT( newX, newY );
+                else return VectorT( newX, newY, static_cast< Double >( this->z ) );
+            }
         }
 
 
-        Vector& Rotate2D( Double rotation, bool isRadian = false )
+        VectorT& Rotate2D( Double rotation, bool isRadian = false )
         {
             *this = this->Rotated2D( rotation, isRadian );
             return *this;
@@ -172,47 +240,71 @@ namespace Game
 
         NumType AtanYX() const
         {
-            return atan2( y, x );
+            if constexpr ( IsFixed ) return Fixed::Atan2( this->y, this->x );
+            else return std::atan2( this->y, this->x );
         }
 
 
         bool IsZero() const
         {
-            return x == 0 && y == 0 && z == 0;
+            const NumType zero = NumType( 0 );
+            if constexpr ( Dimension == 2 ) return this->x == zero && this->y == zero;
+            else return this->x == zero && this->y == zero && this->z == zero;
         }
 
         bool IsNan() const
         {
-            return isnan( x ) || isnan( y ) || isnan( z );
+            if constexpr ( IsFixed ) return false;
+            else if constexpr ( Dimension == 2 ) return std::isnan( this->x ) || std::isnan( this->y );
+            else return std::isnan( this->x ) || std::isnan( this->y ) || std::isnan( this->z );
         }
 
         bool IsInf( ) const
         {
-            return isinf( x ) || isinf( y ) || isinf( z );
+            if constexpr ( IsFixed ) return false;
+            else if constexpr ( Dimension == 2 ) return std::isinf( this->x ) || std::isinf( this->y );
+            else return std::isinf( this->x ) || std::isinf( this->y ) || std::isinf( this->z );
         }
 
-        static Vector Zero()
+        static VectorT Zero()
         {
-            return Vector( 0 );
+            return VectorT( 0 );
         }
 
 
-        static NumType Distance( const Vector& a, const Vector& b )
+        static NumType Distance( const VectorT& a, const VectorT& b )
         {
             return ( a - b ).GetLength();
         }
 
 
-        static Vector Reflect( const Vector& normal, const Vector& vector )
+        static VectorT Reflect( const VectorT& normal, const VectorT& vector )
         {
-            const Vector& P = vector;
-            const Vector& n = normal;
+            const VectorT& P = vector;
+            const VectorT& n = normal;
             return P + n * 2 * ( -P * n );
         }
 
-        static NumType Dot( const Vector& a, const Vector& b )
+        static NumType Dot( const VectorT& a, const VectorT& b )
         {
-            return a.x * b.x + a.y * b.y + a.z * b.z;
+            if constexpr ( Dimension == 2 ) return a.x * b.x + a.y * b.y;
+            else return a.x * b.x + a.y * b.y + a.z * b.z;
         }
     };
+
+    using Vector = VectorT< Double, 3 >;
+    using Vector2f = VectorT< Single, 2 >;
+    using Vector2d = VectorT< Double, 2 >;
+
+    // ĳͿ    ̹Ƿ ùķ̼ 2 մϴ.
+    // ̴ Ŷ   äϴ. SIMULATION_DOUBLE_PRECISION  ϸ Double  ϰ,
+    // SIMULATION_FIXED_POINT  ϸ Fixed  ؼ , ӽ ޶  ϴ.
+#if defined( SIMULATION_FIXED_POINT )
+    using SimulationVector = VectorT< Fixed, 2 >;
+#elif defined( SIMULATION_DOUBLE_PRECISION )
+    using SimulationVector = Vector2d;
+#else
+    using SimulationVector = Vector2f;
+#endif
+    using SimulationNum = SimulationVector::NumType;
 };
@@ -0,0 +1,152 @@
+﻿// =================================================================================================
+//  @file AllocationTracker.cpp
+// 
+//  @brief ALLOCATION_TRACKING 빌드에서 전역 operator new 를 가로채 틱 단계별 할당 횟수와 바이트를 셉니다.
+//  
+//  @date 2026/10/17
+// 
+//  Copyright 2026 2022 Netmarble Neo, Inc. All Rights Reserved.
+// =================================================================================================
+
+
+#include "Network/AllocationTracker.h"
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+
+namespace
+{
+    constexpr Int32 PhaseCount = static_cast< Int32 >( Network::EAllocationPhase::Count );
+
+    std::atomic< UInt64 > allocationCounts[ PhaseCount ];
+    std::atomic< UInt64 > allocationBytes[ PhaseCount ];
+    thread_local Network::EAllocationPhase currentPhase = Network::EAllocationPhase::Other;
+    FILE* statisticsFile = nullptr;
+}
+
+
+Bool Network::AllocationTracker::IsEnabled()
+{
+#ifdef ALLOCATION_TRACKING
+    return true;
+#else
+    return false;
+#endif
+}
+
+
+void Network::AllocationTracker::Open( const Char* path )
+{
+    if ( !IsEnabled() || statisticsFile ) return;
+    if ( fopen_s( &statisticsFile, path, "w" ) != 0 )
+    {
+        statisticsFile = nullptr;
+        return;
+    }
+    fprintf( statisticsFile, "tick,phase,count,bytes\n" );
+}
+
+
+void Network::AllocationTracker::SetPhase( EAllocationPhase phase )
+{
+    currentPhase = phase;
+}
+
+
+void Network::AllocationTracker::OnAllocate( UInt64 size )
+{
+    Int32 phase = static_cast< Int32 >( currentPhase );
+    allocationCounts[ phase ].fetch_add( 1, std::memory_order_relaxed );
+    allocationBytes[ phase ].fetch_add( size, std::memory_order_relaxed );
+}
+
+
+UInt64 Network::AllocationTracker::EndTick( UInt64 tickIndex, EAllocationPhase& worstPhase )
+{
+    UInt64 trackedCount = 0;
+    UInt64 worstCount = 0;
+    worstPhase = EAllocationPhase::Other;
+    for ( Int32 i = 0; i < PhaseCount; i++ )
+    {
+        UInt64 count = allocationCounts[ i ].exchange( 0, std::memory_order_relaxed );
+        UInt64 bytes = allocationBytes[ i ].exchange( 0, std::memory_order_relaxed );
+        if ( count == 0 ) continue;
+        EAllocationPhase phase = static_cast< EAllocationPhase >( i );
+        if ( statisticsFile ) fprintf( statisticsFile, "%llu,%s,%llu,%llu\n", tickIndex, ToString( phase ), count, bytes );
+        if ( phase == EAllocationPhase::Other ) continue;
+        trackedCount += count;
+        if ( count <= worstCount ) continue;
+        worstCount = count;
+        worstPhase = phase;
+    }
+    return trackedCount;
+}
+
+
+#ifdef ALLOCATION_TRACKING
+// 전역 할당을 모두 여기로 모읍니다, 정렬 지정 버전은 기본 구현을 그대로 씁니다.
+void* operator new( std::size_t size )
+{
+    Network::AllocationTracker::OnAllocate( size );
+    void* pointer = std::malloc( size == 0 ? 1 : size );
+    if ( !pointer ) throw std::bad_alloc();
+    return pointer;
+}
+
+
+void* operator new[]( std::size_t size )
+{
+    return operator new( size );
+}
+
+
+void* operator new( std::size_t size, const std::nothrow_t& ) noexcept
+{
+    Network::AllocationTracker::OnAllocate( size );
+    return std::malloc( size == 0 ? 1 : size );
+}
+
+
+void* operator new[]( std::size_t size, const std::nothrow_t& ) noexcept
+{
+    return operator new( size, std::nothrow );
+}
+
+
+void operator delete( void* pointer ) noexcept
+{
+    std::free( pointer );
+}
+
+
+void operator delete[]( void* pointer ) noexcept
+{
+    std::free( pointer );
+}
+
+
+void operator delete( void* pointer, std::size_t ) noexcept
+{
+    std::free( pointer );
+}
+
+
+void operator delete[]( void* pointer, std::size_t ) noexcept
+{
+    std::free( pointer );
+}
+
+
+void operator delete( void* pointer, const std::nothrow_t& ) noexcept
+{
+    std::free( pointer );
+}
+
+
+void operator delete[]( void* pointer, const std::nothrow_t& ) noexcept
+{
+    std::free( pointer );
+}
+#endif
@@ -0,0 +1,87 @@
+﻿// =================================================================================================
+//  @file AllocationTracker.h
+// 
+//  @brief ALLOCATION_TRACKING 빌드에서 전역 operator new 를 가로채 틱 단계별 할당 횟수와 바이트를 셉니다.
+//  
+//  @date 2026/10/17
+// 
+//  Copyright 2026 2022 Netmarble Neo, Inc. All Rights Reserved.
+// =================================================================================================
+
+
+#pragma once
+#include "Define/DataTypes.h"
+
+
+namespace Network
+{
+    enum class EAllocationPhase : Int32
+    {
+        Other, // 표시하지 않은 구간과 I/O 스레드
+        Io,
+        UpdateRooms,
+        RoomMap,
+        RoomPlayerController,
+        RoomCharacter,
+        RoomCollision,
+        RoomItem,
+        RoomKing,
+        RoomStateChange,
+        QueuingMatch,
+        Flush,
+        Count,
+    };
+
+    inline const char* ToString( EAllocationPhase e )
+    {
+        switch ( e )
+        {
+            case EAllocationPhase::Other :
+                return "Other";
+            case EAllocationPhase::Io :
+                return "Io";
+            case EAllocationPhase::UpdateRooms :
+                return "UpdateRooms";
+            case EAllocationPhase::RoomMap :
+                return "RoomMap";
+            case EAllocationPhase::RoomPlayerController :
+                return "RoomPlayerController";
+            case EAllocationPhase::RoomCharacter :
+                return "RoomCharacter";
+            case EAllocationPhase::RoomCollision :
+                return "RoomCollision";
+            case EAllocationPhase::RoomItem :
+                return "RoomItem";
+            case EAllocationPhase::RoomKing :
+                return "RoomKing";
+            case EAllocationPhase::RoomStateChange :
+                return "RoomStateChange";
+            case EAllocationPhase::QueuingMatch :
+                return "QueuingMatch";
+            case EAllocationPhase::Flush :
+                return "Flush";
+            default :
+                return "unknown";
+        }
+    }
+
+    // 단계는 스레드마다 따로 두고, 횟수는 모든 스레드가 같이 셉니다.
+    // 할당 훅 안에서 다시 할당하지 않도록 고정 크기 배열과 원자 변수만 씁니다.
+    class AllocationTracker
+    {
+    public:
+        static Bool IsEnabled();
+        static void Open( const Char* path );
+        static void SetPhase( EAllocationPhase phase );
+        static void OnAllocate( UInt64 size );
+        // 이번 틱 통계를 파일에 한 줄씩 쓰고 지웁니다, Other 를 뺀 할당 횟수를 돌려줍니다.
+        static UInt64 EndTick( UInt64 tickIndex, EAllocationPhase& worstPhase );
+    };
+};
+
+
+#ifdef ALLOCATION_TRACKING
+#define ALLOCATION_PHASE( phase ) Network::AllocationTracker::SetPhase( Network::EAllocationPhase::phase )
+#else
+#define ALLOCATION_PHASE( phase )
+#endif
@@ -0,0 +1,101 @@
+﻿// =================================================================================================
+//  @file BufferPool.cpp
+// 
+//  @brief 세션 수신 링과 송신 큐가 데이터가 오가는 동안만 빌려 쓰는 크기별 블록 풀입니다.
+//  
+//  @date 2026/10/17
+// 
+//  Copyright 2026 2022 Netmarble Neo, Inc. All Rights Reserved.
+// =================================================================================================
+
+
+#include "Network/BufferPool.h"
+#include <cassert>
+
+
+Byte* Network::BufferPool::Acquire( UInt64 size )
+{
+    Int32 classIndex = GetClassIndex( size );
+    BufferPool& pool = GetInstance();
+    std::lock_guard< std::mutex > guard( pool.lock );
+    std::vector< Byte* >& blocks = pool.freeBlocks[ classIndex ];
+    if ( blocks.empty() ) pool.Grow( classIndex, 1 );
+    Byte* block = blocks.back();
+    blocks.pop_back();
+    pool.borrowedBytes += MinBlockSize << classIndex;
+    return block;
+}
+
+
+void Network::BufferPool::Release( Byte* block, UInt64 size )
+{
+    if ( block == nullptr ) return;
+    Int32 classIndex = GetClassIndex( size );
+    BufferPool& pool = GetInstance();
+    std::lock_guard< std::mutex > guard( pool.lock );
+    pool.freeBlocks[ classIndex ].push_back( block );
+    pool.borrowedBytes -= MinBlockSize << classIndex;
+}
+
+
+void Network::BufferPool::Reserve( UInt64 size, UInt64 count )
+{
+    Int32 classIndex = GetClassIndex( size );
+    BufferPool& pool = GetInstance();
+    std::lock_guard< std::mutex > guard( pool.lock );
+    UInt64 freeCount = pool.freeBlocks[ classIndex ].size();
+    if ( freeCount < count ) pool.Grow( classIndex, count - freeCount );
+}
+
+
+UInt64 Network::BufferPool::GetAllocatedBytes()
+{
+    BufferPool& pool = GetInstance();
+    std::lock_guard< std::mutex > guard( pool.lock );
+    return pool.allocatedBytes;
+}
+
+
+UInt64 Network::BufferPool::GetBorrowedBytes()
+{
+    BufferPool& pool = GetInstance();
+    std::lock_guard< std::mutex > guard( pool.lock );
+    return pool.borrowedBytes;
+}
+
+
+Network::BufferPool& Network::BufferPool::GetInstance()
+{
+    static BufferPool instance;
+    return instance;
+}
+
+
+Int32 Network::BufferPool::GetClassIndex( UInt64 size )
+{
+    assert( size <= MaxBlockSize );
+    Int32 classIndex = 0;
+    while ( ( MinBlockSize << classIndex ) < size ) classIndex++;
+    return classIndex;
+}
+
+
+void Network::BufferPool::Grow( Int32 classIndex, UInt64 count )
+{
+    // 작은 블록은 ChunkBytes 단위로 잡아서 잘라 쓰고, 요청한 개수보다 모자라지 않게 잡습니다.
+    UInt64 blockSize = MinBlockSize << classIndex;
+    UInt64 blocksPerChunk = ChunkBytes / blockSize;
+    UInt64 chunkCount = ( count + blocksPerChunk - 1 ) / blocksPerChunk;
+    std::vector< Byte* >& blocks = freeBlocks[ classIndex ];
+    blocks.reserve( blocks.size() + chunkCount * blocksPerChunk );
+    for ( UInt64 c = 0; c < chunkCount; c++ )
+    {
+        chunks.emplace_back( std::make_unique< Byte[] >( ChunkBytes ) );
+        Byte* chunk = chunks.back().get();
+        for ( UInt64 i = 0; i < blocksPerChunk; i++ )
+        {
+            blocks.push_back( chunk + blockSize * i );
+        }
+        allocatedBytes += ChunkBytes;
+    }
+}
@@ -0,0 +1,54 @@
+﻿// =================================================================================================
+//  @file BufferPool.h
+// 
+//  @brief 세션 수신 링과 송신 큐가 데이터가 오가는 동안만 빌려 쓰는 크기별 블록 풀입니다.
+//  
+//  @date 2026/10/17
+// 
+//  Copyright 2026 2022 Netmarble Neo, Inc. All Rights Reserved.
+// =================================================================================================
+
+
+#pragma once
+#include "Define/DataTypes.h"
+#include <array>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+
+namespace Network
+{
+    // 블록 크기는 MinBlockSize 부터 2 배씩 커지는 크기 등급으로 올림합니다.
+    // 돌려받은 블록은 힙에 돌려주지 않고 같은 등급에서 다시 빌려줍니다.
+    // 시뮬레이션 스레드와 I/O 스레드가 같이 쓰므로 잠금으로 보호합니다.
+    class BufferPool
+    {
+    public:
+        static constexpr UInt64 MinBlockSize = 256;
+        static constexpr Int32 ClassCount = 9; // 256 B ~ 64 KiB
+        static constexpr UInt64 MaxBlockSize = MinBlockSize << ( ClassCount - 1 );
+
+    private:
+        static constexpr UInt64 ChunkBytes = 64 * 1024; // 모자랄 때 한 번에 잡아 잘라 쓰는 크기
+
+        std::mutex lock;
+        std::vector< std::unique_ptr< Byte[] > > chunks;
+        std::array< std::vector< Byte* >, ClassCount > freeBlocks;
+        UInt64 allocatedBytes = 0;
+        UInt64 borrowedBytes = 0;
+
+    public:
+        static Byte* Acquire( UInt64 size );
+        static void Release( Byte* block, UInt64 size );
+        // 등급마다 count 개가 빌려줄 수 있게 미리 잡아둡니다.
+        static void Reserve( UInt64 size, UInt64 count );
+        static UInt64 GetAllocatedBytes();
+        static UInt64 GetBorrowedBytes();
+
+    private:
+        static BufferPool& GetInstance();
+        static Int32 GetClassIndex( UInt64 size );
+        void Grow( Int32 classIndex, UInt64 count );
+    };
+};
@@ -0,0 +1,204 @@
+﻿// =================================================================================================
+//  @file IoThread.cpp
+// 
+//  @brief 세션 일부의 소켓 송수신을 전담하는 리액터 스레드입니다.
+//  
+//  @date 2026/10/17
+// 
+//  Copyright 2026 2022 Netmarble Neo, Inc. All Rights Reserved.
+// =================================================================================================
+
+
+#include "Network/IoThread.h"
+#include "Network/Session.h"
+#include "Network/UtillFuntions.h"
+#include <chrono>
+
+
+constexpr Int32 IoThreadWaitMilliseconds = 1;
+
+
+Network::IoThread::IoThread()
+{
+    poller.Initialize();
+}
+
+
+Network::IoThread::~IoThread()
+{
+    Stop();
+}
+
+
+void Network::IoThread::Start()
+{
+    isRunning = true;
+    thread = std::thread( [this]()
+                         {
+                             Run();
+                         }
+                        );
+}
+
+
+void Network::IoThread::Stop()
+{
+    isRunning = false;
+    if ( thread.joinable() ) thread.join();
+}
+
+
+void Network::IoThread::PostRegister( Session* session )
+{
+    std::lock_guard< std::mutex > lock( requestLock );
+    registerRequests.push_back( session );
+}
+
+
+void Network::IoThread::PostWriteInterest( Session* session )
+{
+    std::lock_guard< std::mutex > lock( requestLock );
+    writeRequests.push_back( session );
+}
+
+
+void Network::IoThread::PostReadInterest( Session* session )
+{
+    std::lock_guard< std::mutex > lock( requestLock );
+    readRequests.push_back( session );
+}
+
+
+void Network::IoThread::PostUnregister( Session* session )
+{
+    std::lock_guard< std::mutex > lock( requestLock );
+    unregisterRequests.push_back( session );
+}
+
+
+void Network::IoThread::TakeEvents( std::vector< Session* >& received, std::vector< Session* >& disconnected )
+{
+    received.clear();
+    disconnected.clear();
+    std::lock_guard< std::mutex > lock( eventLock );
+    received.swap( receivedSessions );
+    disconnected.swap( disconnectedSessions );
+}
+
+
+UInt64 Network::IoThread::TakeSystemCallCount()
+{
+    return systemCallCount.exchange( 0 );
+}
+
+
+void Network::IoThread::Run()
+{
+    while ( isRunning )
+    {
+        ApplyRequests();
+        if ( poller.GetRegisteredCount() == 0 )
+        {
+            std::this_thread::sleep_for( std::chrono::milliseconds( IoThreadWaitMilliseconds ) );
+            continue;
+        }
+
+        ResultCode readyCount = poller.Wait( IoThreadWaitMilliseconds );
+        systemCallCount++;
+        if ( readyCount == SOCKET_ERROR )
+        {
+            PrintLastErrorMessageInFile( "Poll" );
+            continue;
+        }
+        if ( readyCount == 0 ) continue;
+
+        poller.VisitReady( readyCount,
+                          [this]( Session* session, Int16 revents )
+                          {
+                              OnReady( session, revents );
+                          }
+                         );
+        // 순회 중에 폴 목록이 바뀌지 않도록 끊어진 세션은 순회가 끝난 뒤 해제합니다.
+        for ( Session* session : lostSessions )
+        {
+            poller.Unregister( session );
+        }
+        PublishEvents();
+    }
+}
+
+
+void Network::IoThread::ApplyRequests()
+{
+    {
+        std::lock_guard< std::mutex > lock( requestLock );
+        applyingRegisters.swap( registerRequests );
+        applyingWrites.swap( writeRequests );
+        applyingReads.swap( readRequests );
+        applyingUnregisters.swap( unregisterRequests );
+    }
+    // 등록 -> 쓰기/읽기 관심 -> 해제 순서로 적용해야 해제된 세션을 건드리지 않습니다.
+    for ( Session* session : applyingRegisters )
+    {
+        poller.Register( session );
+    }
+    for ( Session* session : applyingWrites )
+    {
+        poller.SetWriteInterest( session, true );
+    }
+    for ( Session* session : applyingReads )
+    {
+        poller.SetReadInterest( session, true );
+    }
+    for ( Session* session : applyingUnregisters )
+    {
+        poller.Unregister( session );
+        closesocket( session->GetSocket() );
+        // 이 시점 이후로 시뮬레이션 스레드가 세션을 해제할 수 있습니다.
+        session->MarkIoReleased();
+    }
+    applyingRegisters.clear();
+    applyingWrites.clear();
+    applyingReads.clear();
+    applyingUnregisters.clear();
+}
+
+
+void Network::IoThread::OnReady( Session* session, Int16 revents )
+{
+    if ( revents & ( POLLRDNORM | POLLHUP ) )
+    {
+        systemCallCount++;
+        if ( !session->ReceiveInbound() )
+        {
+            lostSessions.push_back( session );
+            return;
+        }
+        // 링이 가득 찬 채로 읽기 대기를 켜두면 poll 이 바로 깨어나 스레드가 헛돕니다.
+        if ( session->PauseInboundIfFull() ) poller.SetReadInterest( session, false );
+        if ( session->MarkInboundNotified() ) readySessions.push_back( session );
+    }
+    if ( revents & POLLWRNORM )
+    {
+        systemCallCount++;
+        Bool hasRemainBytes = false;
+        if ( !session->SendOutbound( hasRemainBytes ) )
+        {
+            lostSessions.push_back( session );
+            return;
+        }
+        if ( !hasRemainBytes ) poller.SetWriteInterest( session, false );
+    }
+    if ( revents & ( POLLERR | POLLNVAL ) ) lostSessions.push_back( session );
+}
+
+
+void Network::IoThread::PublishEvents()
+{
+    if ( readySessions.empty() && lostSessions.empty() ) return;
+    std::lock_guard< std::mutex > lock( eventLock );
+    receivedSessions.insert( receivedSessions.end(), readySessions.begin(), readySessions.end() );
+    disconnectedSessions.insert( disconnectedSessions.end(), lostSessions.begin(), lostSessions.end() );
+    readySessions.clear();
+    lostSessions.clear();
+}
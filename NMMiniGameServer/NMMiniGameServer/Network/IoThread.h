@@ -0,0 +1,68 @@
+﻿// =================================================================================================
+//  @file IoThread.h
+// 
+//  @brief 세션 일부의 소켓 송수신을 전담하는 리액터 스레드입니다.
+//  
+//  @date 2026/10/17
+// 
+//  Copyright 2026 2022 Netmarble Neo, Inc. All Rights Reserved.
+// =================================================================================================
+
+
+#pragma once
+#include "Define/DataTypes.h"
+#include "Network/Poller.h"
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+namespace Network
+{
+    class Session;
+
+    // 소켓 송수신만 담당하고, 받은 데이터의 처리와 세션 종료는 시뮬레이션 스레드에 넘깁니다.
+    class IoThread
+    {
+    private:
+        Poller poller;
+        std::thread thread;
+        std::atomic< Bool > isRunning{ false };
+        std::atomic< UInt64 > systemCallCount{ 0 };
+
+        std::mutex requestLock;
+        std::vector< Session* > registerRequests;
+        std::vector< Session* > writeRequests;
+        std::vector< Session* > readRequests;
+        std::vector< Session* > unregisterRequests;
+
+        std::mutex eventLock;
+        std::vector< Session* > receivedSessions;
+        std::vector< Session* > disconnectedSessions;
+
+        // 스레드 전용 작업 목록
+        std::vector< Session* > applyingRegisters;
+        std::vector< Session* > applyingWrites;
+        std::vector< Session* > applyingReads;
+        std::vector< Session* > applyingUnregisters;
+        std::vector< Session* > readySessions;
+        std::vector< Session* > lostSessions;
+    public:
+        IoThread();
+        ~IoThread();
+        void Start();
+        void Stop();
+        void PostRegister( Session* session );
+        void PostWriteInterest( Session* session );
+        void PostReadInterest( Session* session );
+        void PostUnregister( Session* session );
+        void TakeEvents( std::vector< Session* >& received, std::vector< Session* >& disconnected );
+        UInt64 TakeSystemCallCount();
+    private:
+        void Run();
+        void ApplyRequests();
+        void OnReady( Session* session, Int16 revents );
+        void PublishEvents();
+    };
+};
@@ -0,0 +1,48 @@
+﻿// =================================================================================================
+//  @file PacketDispatcher.h
+// 
+//  @brief 패킷 종류를 인덱스로 바로 처리 함수를 찾는 컴파일 타임 테이블입니다.
+//  
+//  @date 2026/10/17
+// 
+//  Copyright 2026 2022 Netmarble Neo, Inc. All Rights Reserved.
+// =================================================================================================
+
+
+#pragma once
+#include "Define/DataTypes.h"
+#include "Define/PacketDefine.h"
+#include <array>
+
+
+namespace Network
+{
+    // 처리 함수가 없는 종류는 무시합니다, 크기 검사는 Packet::ClientPacketSizes 로 미리 끝난 상태여야 합니다.
+    template< typename Owner >
+    class PacketDispatcher
+    {
+    public:
+        using Handler = void ( Owner::* )( const Packet::Header* );
+
+    private:
+        std::array< Handler, 256 > handlers{};
+
+    public:
+        constexpr PacketDispatcher& Register( Packet::EType type, Handler handler )
+        {
+            handlers[ static_cast< Byte >( type ) ] = handler;
+            return *this;
+        }
+
+        constexpr Bool HasHandler( Packet::EType type ) const
+        {
+            return handlers[ static_cast< Byte >( type ) ] != nullptr;
+        }
+
+        void Dispatch( Owner& owner, const Packet::Header* packet ) const
+        {
+            Handler handler = handlers[ static_cast< Byte >( packet->Type ) ];
+            if ( handler ) ( owner.*handler )( packet );
+        }
+    };
+};
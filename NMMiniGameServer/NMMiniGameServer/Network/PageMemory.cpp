@@ -0,0 +1,67 @@
+﻿// =================================================================================================
+//  @file PageMemory.cpp
+// 
+//  @brief 시작할 때 한 번에 잡아두는 큰 메모리 블록을 페이지 단위로 할당하고 미리 건드려 둡니다.
+//  
+//  @date 2026/10/17
+// 
+//  Copyright 2026 2022 Netmarble Neo, Inc. All Rights Reserved.
+// =================================================================================================
+
+
+#include "Network/PageMemory.h"
+#include "Network/UtillFuntions.h"
+#include <Windows.h>
+
+
+Byte* Network::PageMemory::Allocate( UInt64 bytes, Bool useLargePages, Bool& isLargePages )
+{
+    isLargePages = false;
+    if ( bytes == 0 ) return nullptr;
+    UInt64 largePageSize = GetLargePageMinimum();
+    if ( useLargePages && largePageSize > 0 && EnableLockMemoryPrivilege() )
+    {
+        UInt64 roundedBytes = ( bytes + largePageSize - 1 ) / largePageSize * largePageSize;
+        void* memory = VirtualAlloc( nullptr, roundedBytes, MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES, PAGE_READWRITE );
+        if ( memory )
+        {
+            isLargePages = true;
+            return static_cast< Byte* >( memory );
+        }
+        PrintLastErrorMessageInFile( "VirtualAlloc large pages" );
+    }
+    void* memory = VirtualAlloc( nullptr, bytes, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE );
+    if ( !memory )
+    {
+        PrintLastErrorMessageInFile( "VirtualAlloc" );
+        exit( 0 );
+    }
+    // 일반 페이지는 처음 쓸 때 폴트가 나므로 지금 한 번씩 써 둡니다, 큰 페이지는 할당할 때 이미 잠겨 있습니다.
+    Prefault( static_cast< Byte* >( memory ), bytes );
+    return static_cast< Byte* >( memory );
+}
+
+
+void Network::PageMemory::Prefault( Byte* memory, UInt64 bytes )
+{
+    volatile Byte* page = memory;
+    for ( UInt64 offset = 0; offset < bytes; offset += SmallPageSize )
+    {
+        page[ offset ] = 0;
+    }
+}
+
+
+Bool Network::PageMemory::EnableLockMemoryPrivilege()
+{
+    HANDLE token = nullptr;
+    if ( !OpenProcessToken( GetCurrentProcess(), TOKEN_ADJUST_PRIVILEGES | TOKEN_QUERY, &token ) ) return false;
+    TOKEN_PRIVILEGES privileges;
+    privileges.PrivilegeCount = 1;
+    privileges.Privileges[ 0 ].Attributes = SE_PRIVILEGE_ENABLED;
+    Bool isEnabled = LookupPrivilegeValue( nullptr, SE_LOCK_MEMORY_NAME, &privileges.Privileges[ 0 ].Luid ) &&
+                     AdjustTokenPrivileges( token, FALSE, &privileges, 0, nullptr, nullptr ) &&
+                     GetLastError() == ERROR_SUCCESS; // 권한이 없어도 AdjustTokenPrivileges 는 성공을 돌려줍니다
+    CloseHandle( token );
+    return isEnabled;
+}
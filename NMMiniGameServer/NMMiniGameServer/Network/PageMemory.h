@@ -0,0 +1,31 @@
+﻿// =================================================================================================
+//  @file PageMemory.h
+// 
+//  @brief 시작할 때 한 번에 잡아두는 큰 메모리 블록을 페이지 단위로 할당하고 미리 건드려 둡니다.
+//  
+//  @date 2026/10/17
+// 
+//  Copyright 2026 2022 Netmarble Neo, Inc. All Rights Reserved.
+// =================================================================================================
+
+
+#pragma once
+#include "Define/DataTypes.h"
+
+
+namespace Network
+{
+    // 큰 페이지는 SeLockMemoryPrivilege 가 있어야 하므로, 실패하면 일반 페이지로 다시 잡습니다.
+    // 서버가 끝날 때까지 쓰는 블록이라 따로 해제하지 않습니다.
+    class PageMemory
+    {
+    public:
+        static constexpr UInt64 SmallPageSize = 4096;
+
+        static Byte* Allocate( UInt64 bytes, Bool useLargePages, Bool& isLargePages );
+        static void Prefault( Byte* memory, UInt64 bytes );
+
+    private:
+        static Bool EnableLockMemoryPrivilege();
+    };
+};
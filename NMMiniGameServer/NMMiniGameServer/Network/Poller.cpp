@@ -0,0 +1,102 @@
+﻿// =================================================================================================
+//  @file Poller.cpp
+// 
+//  @brief 세션 소켓을 한 번만 등록해 두고 준비된 소켓만 처리하기 위한 WSAPoll 기반 리액터입니다.
+//  
+//  @date 2026/10/17
+// 
+//  Copyright 2026 2022 Netmarble Neo, Inc. All Rights Reserved.
+// =================================================================================================
+
+
+#include "Network/Poller.h"
+#include "Network/Session.h"
+#include <cassert>
+
+
+void Network::Poller::Initialize()
+{
+    pollFds.clear();
+    owners.clear();
+    firstSessionIndex = 0;
+}
+
+
+void Network::Poller::Initialize( SocketHandle listenSocket )
+{
+    Initialize();
+    WSAPOLLFD listenFd;
+    listenFd.fd = listenSocket;
+    listenFd.events = POLLRDNORM;
+    listenFd.revents = 0;
+    pollFds.push_back( listenFd );
+    owners.push_back( nullptr );
+    firstSessionIndex = 1;
+}
+
+
+void Network::Poller::Register( Session* session )
+{
+    assert( session->GetIoIndex() == Session::NullIoIndex );
+    WSAPOLLFD sessionFd;
+    sessionFd.fd = session->GetSocket();
+    sessionFd.events = POLLRDNORM;
+    sessionFd.revents = 0;
+    session->SetIoIndex( static_cast< Int32 >( pollFds.size() ) );
+    pollFds.push_back( sessionFd );
+    owners.push_back( session );
+}
+
+
+void Network::Poller::Unregister( Session* session )
+{
+    Int32 index = session->GetIoIndex();
+    if ( index == Session::NullIoIndex ) return;
+    // 마지막 원소와 자리를 바꿔 O(1)로 제거합니다.
+    Int32 lastIndex = static_cast< Int32 >( pollFds.size() ) - 1;
+    if ( index != lastIndex )
+    {
+        pollFds[ index ] = pollFds[ lastIndex ];
+        owners[ index ] = owners[ lastIndex ];
+        owners[ index ]->SetIoIndex( index );
+    }
+    pollFds.pop_back();
+    owners.pop_back();
+    session->SetIoIndex( Session::NullIoIndex );
+}
+
+
+void Network::Poller::SetReadInterest( const Session* session, Bool isEnabled )
+{
+    Int32 index = session->GetIoIndex();
+    if ( index == Session::NullIoIndex ) return;
+    if ( isEnabled ) pollFds[ index ].events |= POLLRDNORM;
+    else pollFds[ index ].events &= ~POLLRDNORM;
+}
+
+
+void Network::Poller::SetWriteInterest( const Session* session, Bool isEnabled )
+{
+    Int32 index = session->GetIoIndex();
+    if ( index == Session::NullIoIndex ) return;
+    if ( isEnabled ) pollFds[ index ].events |= POLLWRNORM;
+    else pollFds[ index ].events &= ~POLLWRNORM;
+}
+
+
+Int32 Network::Poller::Wait( Int32 timeoutMilliseconds )
+{
+    return WSAPoll( pollFds.data(), static_cast< ULONG >( pollFds.size() ), timeoutMilliseconds );
+}
+
+
+Bool Network::Poller::IsListenReady() const
+{
+    return firstSessionIndex > 0 && ( pollFds[ 0 ].revents & POLLRDNORM );
+}
+
+
+size_t Network::Poller::GetRegisteredCount() const
+{
+    return pollFds.size() - firstSessionIndex;
+}
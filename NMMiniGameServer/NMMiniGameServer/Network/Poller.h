@@ -0,0 +1,57 @@
+﻿// =================================================================================================
+//  @file Poller.h
+// 
+//  @brief 세션 소켓을 한 번만 등록해 두고 준비된 소켓만 처리하기 위한 WSAPoll 기반 리액터입니다.
+//  
+//  @date 2026/10/17
+// 
+//  Copyright 2026 2022 Netmarble Neo, Inc. All Rights Reserved.
+// =================================================================================================
+
+
+#pragma once
+#include "Define/DataTypes.h"
+#include <vector>
+#include <WinSock2.h>
+
+
+namespace Network
+{
+    class Session;
+
+    class Poller
+    {
+    private:
+        std::vector< WSAPOLLFD > pollFds; // 리슨 소켓이 있으면 0번
+        std::vector< Session* > owners;
+        Int32 firstSessionIndex = 0;
+    public:
+        void Initialize();
+        void Initialize( SocketHandle listenSocket );
+        void Register( Session* session );
+        void Unregister( Session* session );
+        void SetReadInterest( const Session* session, Bool isEnabled );
+        void SetWriteInterest( const Session* session, Bool isEnabled );
+        Int32 Wait( Int32 timeoutMilliseconds );
+        Bool IsListenReady() const;
+        size_t GetRegisteredCount() const;
+
+        template < class ReadyFunction >
+        void VisitReady( Int32 readyCount, ReadyFunction&& function );
+    };
+
+
+    template < class ReadyFunction >
+    void Poller::VisitReady( Int32 readyCount, ReadyFunction&& function )
+    {
+        if ( firstSessionIndex > 0 && pollFds[ 0 ].revents != 0 ) readyCount--;
+        // 준비된 소켓을 모두 처리하면 바로 빠져나갑니다.
+        for ( size_t i = firstSessionIndex; i < pollFds.size() && readyCount > 0; i++ )
+        {
+            Int16 revents = pollFds[ i ].revents;
+            if ( revents == 0 ) continue;
+            readyCount--;
+            function( owners[ i ], revents );
+        }
+    }
+};
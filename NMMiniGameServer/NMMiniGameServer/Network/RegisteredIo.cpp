@@ -0,0 +1,366 @@
+﻿// =================================================================================================
+//  @file RegisteredIo.cpp
+// 
+//  @brief 등록 버퍼와 완료 큐를 사용하는 Registered I/O(RIO) 엔진입니다.
+//  
+//  @date 2026/10/17
+// 
+//  Copyright 2026 2022 Netmarble Neo, Inc. All Rights Reserved.
+// =================================================================================================
+
+
+#include "Network/RegisteredIo.h"
+#include "Network/Session.h"
+#include "Network/UtillFuntions.h"
+#include <algorithm>
+#include <iostream>
+
+
+Network::RegisteredIo::RegisteredIo()
+{
+    ZeroMemory( &rio, sizeof( rio ) );
+}
+
+
+Network::RegisteredIo::~RegisteredIo()
+{
+    Release();
+}
+
+
+Bool Network::RegisteredIo::Initialize( SocketHandle listenSocket, UInt32 maxSessionCount )
+{
+    std::cout << "Initialize Registered I/O\n";
+    GUID functionTableId = WSAID_MULTIPLE_RIO;
+    DWORD bytes = 0;
+    ResultCode ioctlResult = WSAIoctl( listenSocket,
+                                      SIO_GET_MULTIPLE_EXTENSION_FUNCTION_POINTER,
+                                      &functionTableId,
+                                      sizeof( GUID ),
+                                      &rio,
+                                      sizeof( rio ),
+                                      &bytes,
+                                      nullptr,
+                                      nullptr
+                                     );
+    if ( ioctlResult == SOCKET_ERROR )
+    {
+        PrintLastErrorMessageInFile( "RIOFunctionTable" );
+        return false;
+    }
+
+    // 송수신 요청이 세션당 하나씩만 걸리므로 완료 큐는 세션 수의 2배면 충분합니다.
+    completionQueue = rio.RIOCreateCompletionQueue( maxSessionCount * 2, nullptr );
+    if ( completionQueue == RIO_INVALID_CQ )
+    {
+        PrintLastErrorMessageInFile( "RIOCreateCompletionQueue" );
+        return false;
+    }
+
+    size_t bufferSize = static_cast< size_t >( maxSessionCount ) * ( ReceiveSlotSize + SendSlotSize );
+    buffer = static_cast< Byte* >( VirtualAlloc( nullptr, bufferSize, MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE ) );
+    if ( buffer == nullptr )
+    {
+        PrintLastErrorMessageInFile( "VirtualAlloc" );
+        return false;
+    }
+    bufferId = rio.RIORegisterBuffer( reinterpret_cast< PCHAR >( buffer ), static_cast< DWORD >( bufferSize ) );
+    if ( bufferId == RIO_INVALID_BUFFERID )
+    {
+        PrintLastErrorMessageInFile( "RIORegisterBuffer" );
+        return false;
+    }
+
+    slots.resize( maxSessionCount );
+    freeSlots.reserve( maxSessionCount );
+    for ( Int32 i = static_cast< Int32 >( maxSessionCount ) - 1; i >= 0; i-- )
+    {
+        freeSlots.push_back( i );
+    }
+    pendingSendSessions.reserve( maxSessionCount );
+    deferredReceiveSlots.reserve( maxSessionCount );
+    return true;
+}
+
+
+void Network::RegisteredIo::Release()
+{
+    if ( bufferId != RIO_INVALID_BUFFERID ) rio.RIODeregisterBuffer( bufferId );
+    if ( completionQueue != RIO_INVALID_CQ ) rio.RIOCloseCompletionQueue( completionQueue );
+    if ( buffer ) VirtualFree( buffer, 0, MEM_RELEASE );
+    bufferId = RIO_INVALID_BUFFERID;
+    completionQueue = RIO_INVALID_CQ;
+    buffer = nullptr;
+}
+
+
+Bool Network::RegisteredIo::Register( Session* session )
+{
+    if ( freeSlots.empty() )
+    {
+        session->LogInput( "Registered I/O slot is full\n" );
+        return false;
+    }
+    Int32 slotIndex = freeSlots.back();
+    Slot& slot = slots[ slotIndex ];
+    slot.requestQueue = rio.RIOCreateRequestQueue( session->GetSocket(),
+                                                  1,
+                                                  1,
+                                                  1,
+                                                  1,
+                                                  completionQueue,
+                                                  completionQueue,
+                                                  reinterpret_cast< PVOID >( static_cast< ULONG_PTR >( slotIndex ) )
+                                                 );
+    systemCallCount++;
+    if ( slot.requestQueue == RIO_INVALID_RQ )
+    {
+        PrintLastErrorMessageInFile( "RIOCreateRequestQueue" );
+        return false;
+    }
+    freeSlots.pop_back();
+    slot.owner = session;
+    session->SetIoIndex( slotIndex );
+    PostReceive( slotIndex, 0 );
+    return true;
+}
+
+
+void Network::RegisteredIo::Unregister( Session* session )
+{
+    Int32 slotIndex = session->GetIoIndex();
+    if ( slotIndex == Session::NullIoIndex ) return;
+    slots[ slotIndex ].owner = nullptr;
+    session->SetIoIndex( Session::NullIoIndex );
+    auto it = std::find( pendingSendSessions.begin(), pendingSendSessions.end(), session );
+    if ( it != pendingSendSessions.end() ) pendingSendSessions.erase( it );
+    // 걸려있는 요청은 소켓이 닫히면서 실패로 완료되고, 그때 슬롯이 반환됩니다.
+    TryRecycleSlot( slotIndex );
+}
+
+
+void Network::RegisteredIo::MarkSendPending( Session* session )
+{
+    if ( session->GetIoIndex() == Session::NullIoIndex ) return;
+    pendingSendSessions.push_back( session );
+}
+
+
+void Network::RegisteredIo::ProcessCompletions()
+{
+    // 폴링 모드 완료 큐라 커널 진입 없이 한 번에 꺼내옵니다.
+    RetryStalledReceives();
+    RIORESULT results[ DequeueBatchSize ];
+    while ( true )
+    {
+        ULONG resultCount = rio.RIODequeueCompletion( completionQueue, results, DequeueBatchSize );
+        if ( resultCount == RIO_CORRUPT_CQ )
+        {
+            PrintErrorMessage( "RIODequeueCompletion", "completion queue is corrupted", __FILE__, __LINE__ );
+            return;
+        }
+        for ( ULONG i = 0; i < resultCount; i++ )
+        {
+            const RIORESULT& result = results[ i ];
+            Int32 slotIndex = static_cast< Int32 >( result.SocketContext );
+            ERequest request = static_cast< ERequest >( result.RequestContext );
+            if ( request == ERequest::Receive ) OnReceiveCompleted( slotIndex, result );
+            else OnSendCompleted( slotIndex, result );
+        }
+        if ( resultCount < DequeueBatchSize ) break;
+    }
+}
+
+
+void Network::RegisteredIo::SubmitRequests()
+{
+    // 이번 틱에 쌓인 송신은 요청 큐마다 한 번씩만 제출하고, 지연된 수신도 함께 커밋됩니다.
+    size_t keepCount = 0;
+    for ( Session* session : pendingSendSessions )
+    {
+        if ( session->IsClosed() ) continue;
+        Int32 slotIndex = session->GetIoIndex();
+        if ( !slots[ slotIndex ].isSendPosted ) PostSend( slotIndex );
+        if ( !session->IsClosed() && session->HasSendBytes() ) pendingSendSessions[ keepCount++ ] = session;
+    }
+    pendingSendSessions.resize( keepCount );
+
+    for ( Int32 slotIndex : deferredReceiveSlots )
+    {
+        Slot& slot = slots[ slotIndex ];
+        if ( !slot.isReceiveDeferred ) continue;
+        slot.isReceiveDeferred = false;
+        if ( slot.owner == nullptr || slot.owner->IsClosed() ) continue;
+        rio.RIOReceive( slot.requestQueue, nullptr, 0, RIO_MSG_COMMIT_ONLY, nullptr );
+        systemCallCount++;
+    }
+    deferredReceiveSlots.clear();
+}
+
+
+void Network::RegisteredIo::RetryStalledReceives()
+{
+    // 지난 틱에 세션이 읽기 버퍼를 비웠으면 받기를 다시 겁니다, 여전히 가득 차 있으면 stalledReceiveSlots 에 다시 들어갑니다.
+    if ( stalledReceiveSlots.empty() ) return;
+    retryingReceiveSlots.swap( stalledReceiveSlots );
+    for ( Int32 slotIndex : retryingReceiveSlots )
+    {
+        Slot& slot = slots[ slotIndex ];
+        if ( !slot.isReceiveStalled ) continue;
+        slot.isReceiveStalled = false;
+        if ( slot.owner == nullptr || slot.owner->IsClosed() ) continue;
+        PostReceive( slotIndex, RIO_MSG_DEFER );
+    }
+    retryingReceiveSlots.clear();
+}
+
+
+UInt64 Network::RegisteredIo::TakeSystemCallCount()
+{
+    UInt64 count = systemCallCount;
+    systemCallCount = 0;
+    return count;
+}
+
+
+size_t Network::RegisteredIo::GetRegisteredCount() const
+{
+    return slots.size() - freeSlots.size();
+}
+
+
+void Network::RegisteredIo::PostReceive( Int32 slotIndex, DWORD flags )
+{
+    Slot& slot = slots[ slotIndex ];
+    UInt64 receivableBytes = slot.owner->GetReceivableBytes();
+    if ( receivableBytes == 0 )
+    {
+        // 길이 0 으로 받으면 0 바이트 완료가 와서 끊김과 구분되지 않으므로, 빈 공간이 생길 때까지 미룹니다.
+        if ( !slot.isReceiveStalled ) stalledReceiveSlots.push_back( slotIndex );
+        slot.isReceiveStalled = true;
+        return;
+    }
+    slot.isReceiveStalled = false;
+    RIO_BUF receiveBuffer;
+    receiveBuffer.BufferId = bufferId;
+    receiveBuffer.Offset = GetReceiveSlotOffset( slotIndex );
+    receiveBuffer.Length = static_cast< ULONG >( std::min< UInt64 >( ReceiveSlotSize, receivableBytes ) );
+    BOOL isPosted = rio.RIOReceive( slot.requestQueue,
+                                   &receiveBuffer,
+                                   1,
+                                   flags,
+                                   reinterpret_cast< PVOID >( static_cast< ULONG_PTR >( ERequest::Receive ) )
+                                  );
+    if ( !isPosted )
+    {
+        PrintLastErrorMessageInFile( "RIOReceive" );
+        slot.owner->Close();
+        return;
+    }
+    slot.isReceivePosted = true;
+    if ( flags & RIO_MSG_DEFER )
+    {
+        slot.isReceiveDeferred = true;
+        deferredReceiveSlots.push_back( slotIndex );
+    }
+    else systemCallCount++;
+}
+
+
+Bool Network::RegisteredIo::PostSend( Int32 slotIndex )
+{
+    Slot& slot = slots[ slotIndex ];
+    UInt64 size = slot.owner->PeekSendBytes( GetSendSlotBuffer( slotIndex ), SendSlotSize );
+    if ( size == 0 ) return false;
+
+    RIO_BUF sendBuffer;
+    sendBuffer.BufferId = bufferId;
+    sendBuffer.Offset = GetSendSlotOffset( slotIndex );
+    sendBuffer.Length = static_cast< ULONG >( size );
+    BOOL isPosted = rio.RIOSend( slot.requestQueue, &sendBuffer, 1, 0, reinterpret_cast< PVOID >( static_cast< ULONG_PTR >( ERequest::Send ) ) );
+    systemCallCount++;
+    if ( !isPosted )
+    {
+        PrintLastErrorMessageInFile( "RIOSend" );
+        slot.owner->Close();
+        return false;
+    }
+    slot.isSendPosted = true;
+    slot.isReceiveDeferred = false;
+    slot.owner->ConsumeSendBytes( size );
+    return true;
+}
+
+
+void Network::RegisteredIo::OnReceiveCompleted( Int32 slotIndex, const RIORESULT& result )
+{
+    Slot& slot = slots[ slotIndex ];
+    slot.isReceivePosted = false;
+    Session* session = slot.owner;
+    if ( session == nullptr || session->IsClosed() )
+    {
+        TryRecycleSlot( slotIndex );
+        return;
+    }
+    if ( result.Status != 0 || result.BytesTransferred == 0 )
+    {
+        session->Close();
+        return;
+    }
+    session->OnReceiveCompleted( GetReceiveSlotBuffer( slotIndex ), result.BytesTransferred );
+    if ( !session->IsClosed() ) PostReceive( slotIndex, RIO_MSG_DEFER );
+}
+
+
+void Network::RegisteredIo::OnSendCompleted( Int32 slotIndex, const RIORESULT& result )
+{
+    Slot& slot = slots[ slotIndex ];
+    slot.isSendPosted = false;
+    Session* session = slot.owner;
+    if ( session == nullptr || session->IsClosed() )
+    {
+        TryRecycleSlot( slotIndex );
+        return;
+    }
+    if ( result.Status != 0 )
+    {
+        session->Close();
+        session->LogInput( "connection error" );
+    }
+}
+
+
+void Network::RegisteredIo::TryRecycleSlot( Int32 slotIndex )
+{
+    Slot& slot = slots[ slotIndex ];
+    if ( slot.owner != nullptr || slot.isReceivePosted || slot.isSendPosted ) return;
+    if ( slot.requestQueue == RIO_INVALID_RQ ) return;
+    slot.requestQueue = RIO_INVALID_RQ;
+    slot.isReceiveDeferred = false;
+    slot.isReceiveStalled = false;
+    freeSlots.push_back( slotIndex );
+}
+
+
+Byte* Network::RegisteredIo::GetReceiveSlotBuffer( Int32 slotIndex ) const
+{
+    return buffer + GetReceiveSlotOffset( slotIndex );
+}
+
+
+Byte* Network::RegisteredIo::GetSendSlotBuffer( Int32 slotIndex ) const
+{
+    return buffer + GetSendSlotOffset( slotIndex );
+}
+
+
+ULONG Network::RegisteredIo::GetReceiveSlotOffset( Int32 slotIndex ) const
+{
+    return static_cast< ULONG >( slotIndex ) * ( ReceiveSlotSize + SendSlotSize );
+}
+
+
+ULONG Network::RegisteredIo::GetSendSlotOffset( Int32 slotIndex ) const
+{
+    return GetReceiveSlotOffset( slotIndex ) + ReceiveSlotSize;
+}
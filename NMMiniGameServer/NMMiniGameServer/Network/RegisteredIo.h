@@ -0,0 +1,81 @@
+﻿// =================================================================================================
+//  @file RegisteredIo.h
+// 
+//  @brief 등록 버퍼와 완료 큐를 사용하는 Registered I/O(RIO) 엔진입니다.
+//  
+//  @date 2026/10/17
+// 
+//  Copyright 2026 2022 Netmarble Neo, Inc. All Rights Reserved.
+// =================================================================================================
+
+
+#pragma once
+#include "Define/DataTypes.h"
+#include <vector>
+#include <WinSock2.h>
+#include <MSWSock.h>
+
+
+namespace Network
+{
+    class Session;
+
+    class RegisteredIo
+    {
+    public:
+        static constexpr UInt32 ReceiveSlotSize = 1024;
+        static constexpr UInt32 SendSlotSize = 4096;
+        static constexpr UInt32 DequeueBatchSize = 256;
+    private:
+        enum class ERequest : UInt64
+        {
+            Receive,
+            Send,
+        };
+
+        struct Slot
+        {
+            Session* owner = nullptr;
+            RIO_RQ requestQueue = RIO_INVALID_RQ;
+            Bool isReceivePosted = false;
+            Bool isSendPosted = false;
+            Bool isReceiveDeferred = false;
+            Bool isReceiveStalled = false; // 읽기 버퍼가 가득 차 받기를 걸지 못한 상태
+        };
+
+        RIO_EXTENSION_FUNCTION_TABLE rio;
+        RIO_CQ completionQueue = RIO_INVALID_CQ;
+        RIO_BUFFERID bufferId = RIO_INVALID_BUFFERID;
+        Byte* buffer = nullptr;
+        std::vector< Slot > slots;
+        std::vector< Int32 > freeSlots;
+        std::vector< Session* > pendingSendSessions;
+        std::vector< Int32 > deferredReceiveSlots;
+        std::vector< Int32 > stalledReceiveSlots; // 읽기 버퍼에 빈 공간이 생기면 받기를 다시 겁니다
+        std::vector< Int32 > retryingReceiveSlots;
+        UInt64 systemCallCount = 0;
+    public:
+        RegisteredIo();
+        ~RegisteredIo();
+        Bool Initialize( SocketHandle listenSocket, UInt32 maxSessionCount );
+        Bool Register( Session* session );
+        void Unregister( Session* session );
+        void MarkSendPending( Session* session );
+        void ProcessCompletions();
+        void SubmitRequests();
+        UInt64 TakeSystemCallCount();
+        size_t GetRegisteredCount() const;
+    private:
+        void Release();
+        void PostReceive( Int32 slotIndex, DWORD flags );
+        void RetryStalledReceives();
+        Bool PostSend( Int32 slotIndex );
+        void OnReceiveCompleted( Int32 slotIndex, const RIORESULT& result );
+        void OnSendCompleted( Int32 slotIndex, const RIORESULT& result );
+        void TryRecycleSlot( Int32 slotIndex );
+        Byte* GetReceiveSlotBuffer( Int32 slotIndex ) const;
+        Byte* GetSendSlotBuffer( Int32 slotIndex ) const;
+        ULONG GetReceiveSlotOffset( Int32 slotIndex ) const;
+        ULONG GetSendSlotOffset( Int32 slotIndex ) const;
+    };
+};
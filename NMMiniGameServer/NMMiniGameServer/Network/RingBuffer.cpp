@@ -0,0 +1,199 @@
+﻿// =================================================================================================
+//  @file RingBuffer.cpp
+// 
+//  @brief 바이트를 옮기지 않는 고정 크기 단일 생산자/단일 소비자 링 버퍼입니다.
+//  
+//  @date 2026/10/17
+// 
+//  Copyright 2026 2022 Netmarble Neo, Inc. All Rights Reserved.
+// =================================================================================================
+
+
+#include "Network/RingBuffer.h"
+#include "Network/BufferPool.h"
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <thread>
+
+
+static UInt64 RoundUpPowerOfTwo( UInt64 value )
+{
+    UInt64 result = 1;
+    while ( result < value ) result <<= 1;
+    return result;
+}
+
+
+Network::RingBuffer::RingBuffer( UInt64 capacity )
+    : capacity( RoundUpPowerOfTwo( capacity ) )
+{
+    mask = this->capacity - 1;
+}
+
+
+Network::RingBuffer::~RingBuffer()
+{
+    ReleaseStorage();
+}
+
+
+UInt64 Network::RingBuffer::GetCapacity() const
+{
+    return capacity;
+}
+
+
+UInt64 Network::RingBuffer::GetReadableBytes() const
+{
+    return writePosition.load( std::memory_order_acquire ) - readPosition.load( std::memory_order_acquire );
+}
+
+
+UInt64 Network::RingBuffer::GetWritableBytes() const
+{
+    return capacity - GetReadableBytes();
+}
+
+
+Bool Network::RingBuffer::IsEmpty() const
+{
+    return GetReadableBytes() == 0;
+}
+
+
+void Network::RingBuffer::Clear()
+{
+    // 양쪽 스레드 모두 이 버퍼를 쓰지 않을 때만 부릅니다.
+    readPosition = 0;
+    writePosition = 0;
+    ReleaseStorage();
+}
+
+
+Bool Network::RingBuffer::Write( const Byte* data, UInt64 size )
+{
+    if ( size > GetWritableBytes() ) return false;
+    BeginWrite();
+    UInt64 position = writePosition.load( std::memory_order_relaxed );
+    UInt64 offset = position & mask;
+    UInt64 firstSize = std::min( size, capacity - offset );
+    memcpy( storage + offset, data, firstSize );
+    memcpy( storage, data + firstSize, size - firstSize );
+    writePosition.store( position + size, std::memory_order_release );
+    EndWrite();
+    return true;
+}
+
+
+void Network::RingBuffer::BeginWrite()
+{
+    LockStorage();
+    if ( !storage ) storage = BufferPool::Acquire( capacity );
+}
+
+
+Int32 Network::RingBuffer::GetWriteSegments( WSABUF* segments ) const
+{
+    UInt64 position = writePosition.load( std::memory_order_relaxed );
+    UInt64 writable = GetWritableBytes();
+    if ( writable == 0 ) return 0;
+    UInt64 offset = position & mask;
+    UInt64 firstSize = std::min( writable, capacity - offset );
+    segments[ 0 ].buf = reinterpret_cast< char* >( storage + offset );
+    segments[ 0 ].len = static_cast< ULONG >( firstSize );
+    if ( firstSize == writable ) return 1;
+    segments[ 1 ].buf = reinterpret_cast< char* >( storage );
+    segments[ 1 ].len = static_cast< ULONG >( writable - firstSize );
+    return 2;
+}
+
+
+void Network::RingBuffer::CommitWrite( UInt64 size )
+{
+    assert( size <= GetWritableBytes() );
+    writePosition.store( writePosition.load( std::memory_order_relaxed ) + size, std::memory_order_release );
+}
+
+
+void Network::RingBuffer::EndWrite()
+{
+    // 아무것도 받지 못했으면 빌린 공간을 바로 돌려줍니다.
+    if ( IsEmpty() ) ReleaseStorage();
+    UnlockStorage();
+}
+
+
+UInt64 Network::RingBuffer::Peek( Byte* destination, UInt64 size, UInt64 skip ) const
+{
+    // skip 만큼 건너뛴 위치부터 복사합니다.
+    UInt64 readable = GetReadableBytes();
+    if ( skip >= readable ) return 0;
+    size = std::min( size, readable - skip );
+    UInt64 offset = ( readPosition.load( std::memory_order_relaxed ) + skip ) & mask;
+    UInt64 firstSize = std::min( size, capacity - offset );
+    memcpy( destination, storage + offset, firstSize );
+    memcpy( destination + firstSize, storage, size - firstSize );
+    return size;
+}
+
+
+const Byte* Network::RingBuffer::PeekContiguous( UInt64 size, Byte* scratch ) const
+{
+    // 끝을 넘어가는 경우에만 scratch 로 복사합니다.
+    assert( size <= GetReadableBytes() );
+    UInt64 offset = readPosition.load( std::memory_order_relaxed ) & mask;
+    if ( offset + size <= capacity ) return storage + offset;
+    Peek( scratch, size );
+    return scratch;
+}
+
+
+Int32 Network::RingBuffer::GetReadSegments( WSABUF* segments ) const
+{
+    UInt64 readable = GetReadableBytes();
+    if ( readable == 0 ) return 0;
+    UInt64 offset = readPosition.load( std::memory_order_relaxed ) & mask;
+    UInt64 firstSize = std::min( readable, capacity - offset );
+    segments[ 0 ].buf = reinterpret_cast< char* >( storage + offset );
+    segments[ 0 ].len = static_cast< ULONG >( firstSize );
+    if ( firstSize == readable ) return 1;
+    segments[ 1 ].buf = reinterpret_cast< char* >( storage );
+    segments[ 1 ].len = static_cast< ULONG >( readable - firstSize );
+    return 2;
+}
+
+
+void Network::RingBuffer::Consume( UInt64 size )
+{
+    assert( size <= GetReadableBytes() );
+    readPosition.store( readPosition.load( std::memory_order_relaxed ) + size, std::memory_order_release );
+}
+
+
+void Network::RingBuffer::ReleaseIfEmpty()
+{
+    // 소비자가 다 읽은 뒤 부릅니다, 생산자가 쓰는 중이면 다음 기회로 미룹니다.
+    if ( storageLock.exchange( true, std::memory_order_acquire ) ) return;
+    if ( IsEmpty() ) ReleaseStorage();
+    UnlockStorage();
+}
+
+
+void Network::RingBuffer::LockStorage()
+{
+    while ( storageLock.exchange( true, std::memory_order_acquire ) ) std::this_thread::yield();
+}
+
+
+void Network::RingBuffer::UnlockStorage()
+{
+    storageLock.store( false, std::memory_order_release );
+}
+
+
+void Network::RingBuffer::ReleaseStorage()
+{
+    BufferPool::Release( storage, capacity );
+    storage = nullptr;
+}
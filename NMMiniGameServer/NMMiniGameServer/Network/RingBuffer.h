@@ -0,0 +1,67 @@
+﻿// =================================================================================================
+//  @file RingBuffer.h
+// 
+//  @brief 바이트를 옮기지 않는 고정 크기 단일 생산자/단일 소비자 링 버퍼입니다.
+//  
+//  @date 2026/10/17
+// 
+//  Copyright 2026 2022 Netmarble Neo, Inc. All Rights Reserved.
+// =================================================================================================
+
+
+#pragma once
+#include "Define/DataTypes.h"
+#include <WinSock2.h>
+#include <atomic>
+
+
+namespace Network
+{
+    // 생산자 스레드 하나, 소비자 스레드 하나일 때 잠금 없이 사용할 수 있습니다.
+    // 위치 값은 계속 증가하고 용량(2의 거듭제곱)으로 마스킹해서 인덱스로 씁니다.
+    // 저장 공간은 쓰기 시작할 때 BufferPool 에서 빌리고 비면 돌려줍니다.
+    // 비어 있을 때만 돌려주고 소비자는 읽을 데이터가 있을 때만 저장 공간을 보므로,
+    // 빌리고 돌려주는 순간만 storageLock 으로 막으면 됩니다.
+    class RingBuffer
+    {
+    public:
+        static constexpr Int32 MaxSegmentCount = 2;
+
+    private:
+        Byte* storage = nullptr;
+        UInt64 capacity = 0;
+        UInt64 mask = 0;
+        std::atomic< UInt64 > readPosition{ 0 };
+        std::atomic< UInt64 > writePosition{ 0 };
+        std::atomic< Bool > storageLock{ false };
+
+    public:
+        explicit RingBuffer( UInt64 capacity );
+        ~RingBuffer();
+
+        UInt64 GetCapacity() const;
+        UInt64 GetReadableBytes() const;
+        UInt64 GetWritableBytes() const;
+        Bool IsEmpty() const;
+        void Clear();
+
+        // 생산자, GetWriteSegments 와 CommitWrite 는 BeginWrite 와 EndWrite 사이에서만 부릅니다.
+        Bool Write( const Byte* data, UInt64 size );
+        void BeginWrite();
+        Int32 GetWriteSegments( WSABUF* segments ) const;
+        void CommitWrite( UInt64 size );
+        void EndWrite();
+
+        // 소비자
+        UInt64 Peek( Byte* destination, UInt64 size, UInt64 skip = 0 ) const;
+        const Byte* PeekContiguous( UInt64 size, Byte* scratch ) const;
+        Int32 GetReadSegments( WSABUF* segments ) const;
+        void Consume( UInt64 size );
+        void ReleaseIfEmpty();
+
+    private:
+        void LockStorage();
+        void UnlockStorage();
+        void ReleaseStorage();
+    };
+};
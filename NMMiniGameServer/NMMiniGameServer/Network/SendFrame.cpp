@@ -0,0 +1,216 @@
+﻿// =================================================================================================
+//  @file SendFrame.cpp
+// 
+//  @brief 여러 세션이 같은 바이트를 참조해서 보낼 수 있는 참조 카운트 송신 프레임입니다.
+//  
+//  @date 2026/10/17
+// 
+//  Copyright 2026 2022 Netmarble Neo, Inc. All Rights Reserved.
+// =================================================================================================
+
+
+#include "Network/SendFrame.h"
+#include "Network/BufferPool.h"
+#include "Define/PacketDefine.h"
+#include <cassert>
+#include <cstring>
+#include <thread>
+
+
+UInt32 Network::SendFrame::GetRemainBytes() const
+{
+    return Capacity - size;
+}
+
+
+Bool Network::SendFrame::Append( const Byte* source, UInt32 length )
+{
+    if ( length > GetRemainBytes() ) return false;
+    memcpy( data.data() + size, source, length );
+    size += length;
+    return true;
+}
+
+
+Bool Network::SendFrame::AppendPacket( const Byte* packet, UInt32 length, Byte version )
+{
+    // 버전 1 형식 패킷을 받아서 세션 버전의 헤더로 바꿔 씁니다.
+    if ( version < Packet::ProtocolVersion2 ) return Append( packet, length );
+    UInt32 framedSize = GetFramedSize( length, version );
+    if ( framedSize > GetRemainBytes() ) return false;
+    const Packet::Header* header = reinterpret_cast< const Packet::Header* >( packet );
+    Packet::HeaderV2 headerV2;
+    headerV2.Size = static_cast< UInt16 >( framedSize );
+    headerV2.Type = header->Type;
+    Append( reinterpret_cast< const Byte* >( &headerV2 ), sizeof( headerV2 ) );
+    Append( packet + sizeof( Packet::Header ), length - sizeof( Packet::Header ) );
+    return true;
+}
+
+
+UInt32 Network::SendFrame::GetFramedSize( UInt32 length, Byte version )
+{
+    if ( version < Packet::ProtocolVersion2 ) return length;
+    return length - sizeof( Packet::Header ) + sizeof( Packet::HeaderV2 );
+}
+
+
+void Network::SendFrame::AddReference()
+{
+    referenceCount.fetch_add( 1, std::memory_order_relaxed );
+}
+
+
+Network::SendFrame* Network::SendFramePool::Acquire()
+{
+    SendFramePool& pool = GetInstance();
+    SendFrame* frame = nullptr;
+    {
+        std::lock_guard< std::mutex > guard( pool.lock );
+        if ( pool.freeFrames.empty() ) pool.Grow();
+        frame = pool.freeFrames.back();
+        pool.freeFrames.pop_back();
+    }
+    frame->size = 0;
+    frame->referenceCount.store( 1, std::memory_order_relaxed );
+    return frame;
+}
+
+
+void Network::SendFramePool::Release( SendFrame* frame )
+{
+    if ( frame == nullptr ) return;
+    if ( frame->referenceCount.fetch_sub( 1, std::memory_order_acq_rel ) != 1 ) return;
+    SendFramePool& pool = GetInstance();
+    std::lock_guard< std::mutex > guard( pool.lock );
+    pool.freeFrames.push_back( frame );
+}
+
+
+size_t Network::SendFramePool::GetAllocatedCount()
+{
+    SendFramePool& pool = GetInstance();
+    std::lock_guard< std::mutex > guard( pool.lock );
+    return pool.chunks.size() * GrowCount;
+}
+
+
+void Network::SendFramePool::Reserve( size_t count )
+{
+    SendFramePool& pool = GetInstance();
+    std::lock_guard< std::mutex > guard( pool.lock );
+    while ( pool.chunks.size() * GrowCount < count ) pool.Grow();
+}
+
+
+Network::SendFramePool& Network::SendFramePool::GetInstance()
+{
+    static SendFramePool instance;
+    return instance;
+}
+
+
+void Network::SendFramePool::Grow()
+{
+    chunks.emplace_back( std::make_unique< SendFrame[] >( GrowCount ) );
+    SendFrame* chunk = chunks.back().get();
+    for ( size_t i = 0; i < GrowCount; i++ )
+    {
+        freeFrames.push_back( &chunk[ i ] );
+    }
+}
+
+
+Network::SendQueue::SendQueue( UInt64 capacity )
+{
+    UInt64 roundedCapacity = 1;
+    while ( roundedCapacity < capacity ) roundedCapacity <<= 1;
+    this->capacity = roundedCapacity;
+    mask = roundedCapacity - 1;
+}
+
+
+Network::SendQueue::~SendQueue()
+{
+    ReleaseStorage();
+}
+
+
+UInt64 Network::SendQueue::GetStorageBytes() const
+{
+    return capacity * sizeof( SendEntry );
+}
+
+
+UInt64 Network::SendQueue::GetCount() const
+{
+    return writePosition.load( std::memory_order_acquire ) - readPosition.load( std::memory_order_acquire );
+}
+
+
+Bool Network::SendQueue::IsEmpty() const
+{
+    return GetCount() == 0;
+}
+
+
+Bool Network::SendQueue::Push( const SendEntry& entry )
+{
+    if ( GetCount() == capacity ) return false;
+    LockStorage();
+    if ( !entries ) entries = reinterpret_cast< SendEntry* >( BufferPool::Acquire( GetStorageBytes() ) );
+    UInt64 position = writePosition.load( std::memory_order_relaxed );
+    entries[ position & mask ] = entry;
+    writePosition.store( position + 1, std::memory_order_release );
+    UnlockStorage();
+    return true;
+}
+
+
+Network::SendEntry& Network::SendQueue::At( UInt64 index )
+{
+    assert( index < GetCount() );
+    return entries[ ( readPosition.load( std::memory_order_relaxed ) + index ) & mask ];
+}
+
+
+const Network::SendEntry& Network::SendQueue::At( UInt64 index ) const
+{
+    assert( index < GetCount() );
+    return entries[ ( readPosition.load( std::memory_order_relaxed ) + index ) & mask ];
+}
+
+
+void Network::SendQueue::Pop()
+{
+    assert( !IsEmpty() );
+    readPosition.store( readPosition.load( std::memory_order_relaxed ) + 1, std::memory_order_release );
+}
+
+
+void Network::SendQueue::ReleaseIfEmpty()
+{
+    // 소비자가 다 보낸 뒤 부릅니다, 생산자가 넣는 중이면 다음 기회로 미룹니다.
+    if ( storageLock.exchange( true, std::memory_order_acquire ) ) return;
+    if ( IsEmpty() ) ReleaseStorage();
+    UnlockStorage();
+}
+
+
+void Network::SendQueue::LockStorage()
+{
+    while ( storageLock.exchange( true, std::memory_order_acquire ) ) std::this_thread::yield();
+}
+
+
+void Network::SendQueue::UnlockStorage()
+{
+    storageLock.store( false, std::memory_order_release );
+}
+
+
+void Network::SendQueue::ReleaseStorage()
+{
+    BufferPool::Release( reinterpret_cast< Byte* >( entries ), GetStorageBytes() );
+    entries = nullptr;
+}
@@ -0,0 +1,102 @@
+﻿// =================================================================================================
+//  @file SendFrame.h
+// 
+//  @brief 여러 세션이 같은 바이트를 참조해서 보낼 수 있는 참조 카운트 송신 프레임입니다.
+//  
+//  @date 2026/10/17
+// 
+//  Copyright 2026 2022 Netmarble Neo, Inc. All Rights Reserved.
+// =================================================================================================
+
+
+#pragma once
+#include "Define/DataTypes.h"
+#include <array>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+
+namespace Network
+{
+    struct SendFrame
+    {
+        static constexpr UInt32 Capacity = 1024;
+
+        std::atomic< Int32 > referenceCount{ 0 };
+        UInt32 size = 0;
+        std::array< Byte, Capacity > data;
+
+        UInt32 GetRemainBytes() const;
+        Bool Append( const Byte* source, UInt32 length );
+        Bool AppendPacket( const Byte* packet, UInt32 length, Byte version );
+        void AddReference();
+
+        static UInt32 GetFramedSize( UInt32 length, Byte version );
+    };
+
+    // 프레임은 돌려받아 재사용하고, 모자라면 묶음으로 새로 만듭니다.
+    // 시뮬레이션 스레드가 빌리고 I/O 스레드가 돌려줄 수 있어 잠금으로 보호합니다.
+    class SendFramePool
+    {
+    private:
+        static constexpr size_t GrowCount = 64;
+
+        std::mutex lock;
+        std::vector< std::unique_ptr< SendFrame[] > > chunks;
+        std::vector< SendFrame* > freeFrames;
+
+    public:
+        static SendFrame* Acquire();
+        static void Release( SendFrame* frame );
+        static size_t GetAllocatedCount();
+        static void Reserve( size_t count );
+
+    private:
+        static SendFramePool& GetInstance();
+        void Grow();
+    };
+
+    // 세션 송신 큐의 한 칸, 프레임의 [begin, end) 구간을 가리킵니다.
+    struct SendEntry
+    {
+        SendFrame* frame = nullptr;
+        UInt32 begin = 0;
+        UInt32 end = 0;
+    };
+
+    // 단일 생산자/단일 소비자 송신 큐, 위치 값은 계속 증가하고 용량으로 마스킹합니다.
+    // 칸 배열은 RingBuffer 처럼 넣을 때 BufferPool 에서 빌리고 비면 돌려줍니다.
+    class SendQueue
+    {
+    private:
+        SendEntry* entries = nullptr;
+        UInt64 capacity = 0;
+        UInt64 mask = 0;
+        std::atomic< UInt64 > readPosition{ 0 };
+        std::atomic< UInt64 > writePosition{ 0 };
+        std::atomic< Bool > storageLock{ false };
+
+    public:
+        explicit SendQueue( UInt64 capacity );
+        ~SendQueue();
+
+        UInt64 GetStorageBytes() const;
+
+        UInt64 GetCount() const;
+        Bool IsEmpty() const;
+        // 생산자
+        Bool Push( const SendEntry& entry );
+        // 소비자
+        SendEntry& At( UInt64 index );
+        const SendEntry& At( UInt64 index ) const;
+        void Pop();
+        void ReleaseIfEmpty();
+
+    private:
+        void LockStorage();
+        void UnlockStorage();
+        void ReleaseStorage();
+    };
+};
@@ -11,8 +11,11 @@
 
 #include "Network/Server.h"
 #include "Network/Session.h"
+#include "Network/AllocationTracker.h"
+#include "Network/BufferPool.h"
 #include "Network/UtillFuntions.h"
 #include "Define/MapData.h"
+#include "Game/FrameAllocator.h"
 #include "Game/Room.h"
 #include "Game/PlayerController.h"
 #include <algorithm>
@@ -21,10 +24,140 @@
 #include <thread>
 #include <WinSock2.h>
 #include <WS2tcpip.h>
+#include <Windows.h>
 
 #pragma comment(lib, "ws2_32.lib")
 
 
+constexpr Double IoStatisticsReportSeconds = 5.0;
+
+
+static UInt64 GetProcessCpuTime()
+{
+    FILETIME creationTime, exitTime, kernelTime, userTime;
+    GetProcessTimes( GetCurrentProcess(), &creationTime, &exitTime, &kernelTime, &userTime );
+    ULARGE_INTEGER kernel, user;
+    kernel.LowPart = kernelTime.dwLowDateTime;
+    kernel.HighPart = kernelTime.dwHighDateTime;
+    user.LowPart = userTime.dwLowDateTime;
+    user.HighPart = userTime.dwHighDateTime;
+    return kernel.QuadPart + user.QuadPart;
+}
+
+
+static Bool MakeScriptedInput( UInt64 step, Packet::Client::Input& input )
+{
+    // 120 ƽ ֱ ¿ ȸ  ֽϴ,    false Դϴ.
+    step %= 120;
+    input.left = step == 0 ? Packet::EInputState::Press :
+                 step == 30 ? Packet::EInputState::Release : Packet::EInputState::None;
+    input.right = step == 60 ? Packet::EInputState::Press :
+                  step == 90 ? Packet::EInputState::Release : Packet::EInputState::None;
+    input.rush = step % 40 == 10 ? Packet::EInputState::Click : Packet::EInputState::None;
+    return input.left != Packet::EInputState::None ||
+           input.right != Packet::EInputState::None ||
+           input.rush != Packet::EInputState::None;
+}
+
+
+static Byte GetLoopbackVersion( Int32 playerIndex )
+{
+    // Ҵ ˻  ÷̾  2, 3  TCP , UDP   ϴ.
+    return playerIndex % 2 == 0 ? Packet::ProtocolVersion2 : Packet::ProtocolVersion3;
+}
+
+
+static Bool IsLoopbackUnreliable( Int32 playerIndex )
+{
+    return playerIndex % 4 >= 2;
+}
+
+
+static void CloseLoopbackClient( Network::LoopbackClient& client )
+{
+    if ( client.tcpSocket != INVALID_SOCKET ) closesocket( client.tcpSocket );
+    if ( client.udpSocket != INVALID_SOCKET ) closesocket( client.udpSocket );
+    client = Network::LoopbackClient();
+}
+
+
+static Bool ConnectLoopbackClient( Network::LoopbackClient& client, UInt16 port, Byte version, Bool isUnreliable )
+{
+    //  Ʈ  Hello   մϴ, ϸ ȣ  ݽϴ.
+    SOCKADDR_IN address;
+    ZeroMemory( &address, sizeof( SOCKADDR_IN ) );
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl( INADDR_LOOPBACK );
+    address.sin_port = htons( port );
+    client.tcpSocket = socket( AF_INET, SOCK_STREAM, IPPROTO_TCP );
+    if ( client.tcpSocket == INVALID_SOCKET ) return false;
+    if ( connect( client.tcpSocket, ( SOCKADDR* )&address, sizeof( address ) ) == SOCKET_ERROR ) return false;
+    SOCKADDR_IN localAddress;
+    INT32 addressLength = sizeof( localAddress );
+    if ( getsockname( client.tcpSocket, ( SOCKADDR* )&localAddress, &addressLength ) == SOCKET_ERROR ) return false;
+    client.localPort = ntohs( localAddress.sin_port );
+    u_long on = 1;
+    if ( ioctlsocket( client.tcpSocket, FIONBIO, &on ) == SOCKET_ERROR ) return false;
+    Packet::Client::Hello hello;
+    hello.version = version;
+    send( client.tcpSocket, reinterpret_cast< const char* >( &hello ), sizeof( hello ), 0 );
+    if ( !isUnreliable ) return true;
+
+    client.udpSocket = socket( AF_INET, SOCK_DGRAM, IPPROTO_UDP );
+    if ( client.udpSocket == INVALID_SOCKET ) return false;
+    address.sin_port = 0;
+    if ( bind( client.udpSocket, ( SOCKADDR* )&address, sizeof( address ) ) == SOCKET_ERROR ) return false;
+    return ioctlsocket( client.udpSocket, FIONBIO, &on ) != SOCKET_ERROR;
+}
+
+
+static void SendLoopbackToken( const Network::LoopbackClient& client, UInt16 port, UInt32 token )
+{
+    //  TCP   ū UDP   ǰ ϴ.
+    SOCKADDR_IN address;
+    ZeroMemory( &address, sizeof( SOCKADDR_IN ) );
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl( INADDR_LOOPBACK );
+    address.sin_port = htons( port );
+    Packet::Udp::DatagramHeader header;
+    header.token = token;
+    header.sequence = 0;
+    sendto( client.udpSocket, reinterpret_cast< const char* >( &header ), sizeof( header ), 0, ( const SOCKADDR* )&address, sizeof( address ) );
+}
+
+
+static void SendLoopbackInput( const Network::LoopbackClient& client, Byte version, const Packet::Client::Input& input )
+{
+    // SendFrame::AppendPacket ó  1     ٲ ϴ.
+    Byte frame[ sizeof( Packet::HeaderV2 ) + sizeof( Packet::Client::Input ) ];
+    Packet::HeaderV2 header;
+    header.Size = static_cast< UInt16 >( Network::SendFrame::GetFramedSize( sizeof( input ), version ) );
+    header.Type = input.header.Type;
+    memcpy( frame, &header, sizeof( header ) );
+    memcpy( frame + sizeof( header ), reinterpret_cast< const Byte* >( &input ) + sizeof( Packet::Header ), sizeof( input ) - sizeof( Packet::Header ) );
+    send( client.tcpSocket, reinterpret_cast< const char* >( frame ), header.Size, 0 );
+}
+
+
+static Bool DrainLoopbackClient( const Network::LoopbackClient& client )
+{
+    //    о  и Ŭ̾Ʈ  ʰ մϴ,   false Դϴ.
+    char buffer[ 4096 ];
+    while ( true )
+    {
+        Int32 receivedBytes = recv( client.tcpSocket, buffer, sizeof( buffer ), 0 );
+        if ( receivedBytes == 0 ) return false;
+        if ( receivedBytes == SOCKET_ERROR ) break;
+    }
+    if ( WSAGetLastError() != WSAEWOULDBLOCK ) return false;
+    if ( client.udpSocket == INVALID_SOCKET ) return true;
+    while ( recvfrom( client.udpSocket, buffer, sizeof( buffer ), 0, nullptr, nullptr ) != SOCKET_ERROR )
+    {
+    }
+    return true;
+}
+
+
 Network::ReadyMatch::ReadyMatch()
 {
     userReadys.resize( Constant::MaxUserCount );
@@ -39,6 +172,10 @@ Network::Server::Server()
 
 Network::Server::~Server()
 {
+    for ( auto& ioThread : ioThreads )
+    {
+        ioThread->Stop();
+    }
 }
 
 
@@ -46,11 +183,39 @@ Void Network::Server::Initialize( UInt16 Port )
 {
     Constant::LoadMapData( "map.txt" );
     Constant::SaveMapData( "map.txt" );
+    if ( Constant::MaxUserCount < 1 || Constant::MaxUserCount > Game::MaxPlayerCount )
+    {
+        std::cout << "MaxUserCount  1 ~ " << Game::MaxPlayerCount << " ̿ մϴ\n";
+        exit( 0 );
+    }
     listenPort = Port;
+    ioEngine = static_cast< EIoEngine >( Constant::ServerIoEngine );
+    useIoThreads = ioEngine == EIoEngine::Poll && Constant::ServerIoThreadCount > 0;
     InitializeSocket();
     CreateListenSocket();
     BindListenSocket();
+    if ( Constant::ServerUdpEnabled ) udpChannel.Initialize( listenPort );
+    sessions.Initialize( static_cast< UInt32 >( Constant::ServerMaxSessionCount ) );
+    rooms.Initialize( static_cast< UInt32 >( Constant::ServerMaxRoomCount ) );
+    if ( Constant::ServerPreallocate ) PreallocateCapacity();
+    Game::CharacterStore::SelectKernel( static_cast< Game::ECharacterKernel >( Constant::ServerCharacterKernel ) );
+#ifdef SIMULATION_FIXED_POINT
+    if ( Constant::TickTerm != Game::FixedSimulationTicksPerSecond )
+        std::cout << "[Simulation] TickTerm " << Constant::TickTerm << "    " << Game::FixedSimulationTicksPerSecond
+                  << "  ޶  ӵ " << static_cast< Double >( Constant::TickTerm ) / Game::FixedSimulationTicksPerSecond << " 谡 ˴ϴ\n";
+#endif
+#ifdef _DEBUG
+    //     SIMD Ŀ Į Ŀΰ Ʈ   Ȯմϴ.
+    if ( !Game::CharacterStore::VerifyKernels() ) exit( 1 );
+#ifdef SIMULATION_FIXED_POINT
+    if ( !VerifyDeterministicMatch() ) exit( 1 );
+#endif
+#endif
+    if ( Constant::ServerRoomBenchTicks > 0 ) RunRoomBenchmark();
+    if ( AllocationTracker::IsEnabled() ) AllocationTracker::Open( "allocation_stats.csv" );
     timer.Reset();
+    ioStatistics.reportTime = std::chrono::system_clock::now();
+    ioStatistics.reportCpuTime = GetProcessCpuTime();
 }
 
 
@@ -61,18 +226,47 @@ Void Network::Server::Process()
     std::cout << "Start chat server / port : " << listenPort << "\n";
     auto start = std::chrono::system_clock::now();
     auto prev = start;
+    StartAllocationCheck();
     while ( true )
     {
-        Select();
+        tickIndex++;
+        Game::FrameAllocator::Reset();
+        ALLOCATION_PHASE( Io );
+        ResumeThrottledSessions();
+        ProcessIo();
         timer.Tick( Constant::TickTerm );
+        // Tick  ƽ ݱ ٸǷ, ٸ ð ۽   ʰ  ڿ ϴ.
+        auto inputTime = std::chrono::system_clock::now();
+        ALLOCATION_PHASE( UpdateRooms );
+        UpdateAllocationCheck();
         UpdateRooms( timer.GetTimeElapsed() );
+        RemoveExpiredRoom();
         //std::cout << "Update" << std::endl;
+        ALLOCATION_PHASE( QueuingMatch );
         if ( turnOnMatch )
         {
             QueuingMatch();
             turnOnMatch = false;
         }
+        ALLOCATION_PHASE( Flush );
+        FlushStateLanes();
+        if ( udpChannel.IsOpened() )
+        {
+            udpChannel.Flush();
+            ioStatistics.systemCallCount += udpChannel.TakeSystemCallCount();
+        }
+        if ( !pendingFlushSessions.empty() )
+        {
+            FlushSessions();
+            TimeSecond latency = std::chrono::system_clock::now() - inputTime;
+            ioStatistics.flushCount++;
+            ioStatistics.flushLatencySum += latency.count();
+            ioStatistics.flushLatencyMax = std::max( ioStatistics.flushLatencyMax, latency.count() );
+        }
         RemoveExpiredSession(); // TODO:  ʿ!!
+        ALLOCATION_PHASE( Other );
+        EndAllocationTick();
+        ReportIoStatistics();
     }
     return;
 }
@@ -91,7 +285,7 @@ void Network::Server::CancelRequest( Session* requester )
                            matchQueue.end(),
                            [requester]( const RequestMatch& match )
                            {
-                               return match.requester == requester;
+                               return match.requester == requester->GetHandle();
                            }
                           );
     if(it != matchQueue.end() ) matchQueue.erase( it );
@@ -105,12 +299,12 @@ void Network::Server::PostReadyMatch( Session* requester )
                            readyMatches.end(),
                            [requester, this]( const ReadyMatch& ready )
                            {
-                               return ready.users.end() != std::find( ready.users.begin(), ready.users.end(), requester );
+                               return ready.users.end() != std::find( ready.users.begin(), ready.users.end(), requester->GetHandle() );
                            }
                           );
     if ( it != readyMatches.end() )
     {
-        Int32 index = std::distance( it->users.begin(), std::find( it->users.begin(), it->users.end(), requester ) );
+        Int32 index = std::distance( it->users.begin(), std::find( it->users.begin(), it->users.end(), requester->GetHandle() ) );
         it->userReadys[ index ] = true;
         if ( std::all_of( it->userReadys.begin(),
                          it->userReadys.end(),
@@ -120,13 +314,31 @@ void Network::Server::PostReadyMatch( Session* requester )
                          }
                         ) )
         {
-            auto& room = AddNewRoom( Constant::MaxUserCount );
+            Game::Room* room = AddNewRoom( Constant::MaxUserCount );
+            if ( !room )
+            {
+                //   á  ٽ Ī ⿭ ϴ.
+                std::cout << "Room pool is full\n";
+                for ( SessionHandle handle : it->users )
+                {
+                    Session* session = FindSession( handle );
+                    if ( !session ) continue;
+                    Packet::Server::CancelReadyMatching packet;
+                    session->SendPacket( &packet );
+                    RequestMatch req;
+                    req.requester = handle;
+                    AddRequest( req );
+                }
+                readyMatches.erase( it );
+                return;
+            }
             std::cout << "Queuing Request Matches\n";
             for ( Int32 i = 0; i < Constant::MaxUserCount; i++ )
             {
-                room.AddSession( i, it->users[ i ] );
+                Session* session = FindSession( it->users[ i ] );
+                if ( session ) room->AddSession( i, session );
             }
-            room.ReadyToGame();
+            room->ReadyToGame();
             readyMatches.erase( it );
         }
     }
@@ -139,20 +351,22 @@ void Network::Server::PostCancelReadyMatch( Session* requester )
                            readyMatches.end(),
                            [requester, this]( const ReadyMatch& ready )
                            {
-                               return ready.users.end() != std::find( ready.users.begin(), ready.users.end(), requester );
+                               return ready.users.end() != std::find( ready.users.begin(), ready.users.end(), requester->GetHandle() );
                            }
                           );
     if ( it != readyMatches.end() )
     {
-        for ( Session* i : it->users )
+        for ( SessionHandle handle : it->users )
         {
+            Session* i = FindSession( handle );
+            if ( !i ) continue;
             Packet::Server::CancelReadyMatching packet;
             i->SendPacket( &packet );
 
             if ( i != requester )
             {
                 RequestMatch req;
-                req.requester = i;
+                req.requester = handle;
                 AddRequest( req );
             }
             std::cout << "Add Request " << std::endl;
@@ -180,10 +394,43 @@ void Network::Server::InitializeSocket()
 }
 
 
+void Network::Server::PreallocateCapacity()
+{
+    // ִ 뷮ŭ ̸  ξ 뷮 ȿ  ðų   ǵ帮 ʰ մϴ.
+    // Ϳ 迭   0  äǷ  ͸  ϴ.
+    std::cout << "Preallocate Capacity\n";
+    UInt64 matchBytes = static_cast< UInt64 >( Constant::ServerRoomArenaBytes );
+    Bool isLargePages = Game::RoomArena::ReserveMatchBuffers( rooms.GetCapacity(), matchBytes, Constant::ServerLargePages != 0 );
+    sessions.Preallocate( INVALID_SOCKET, this );
+    rooms.Preallocate( Constant::MaxUserCount, this, Constant::ServerRoomSpecialized != 0 );
+    SendFramePool::Reserve( sessions.GetCapacity() ); // Ǹ δ  ϳ
+    //  ۴  ȸ , 뷮  ÿ   ִٰ  ƵӴϴ.
+    BufferPool::Reserve( Session::ReceiveBufferSize, sessions.GetCapacity() );
+    BufferPool::Reserve( Session::SendQueueSize * sizeof( SendEntry ), sessions.GetCapacity() );
+    BufferPool::Reserve( Session::StateLaneSlotSize * Session::StateLaneSlotCount, sessions.GetCapacity() );
+
+    UInt64 sessionBytes = sessions.GetCapacity() * sizeof( Session ) + BufferPool::GetAllocatedBytes();
+    UInt64 roomBytes = rooms.GetCapacity() * sizeof( Game::Room );
+    UInt64 arenaBytes = rooms.GetCapacity() * matchBytes;
+    UInt64 frameBytes = SendFramePool::GetAllocatedCount() * sizeof( SendFrame );
+    std::cout << "[Capacity] sessions " << sessions.GetCapacity()
+              << " rooms " << rooms.GetCapacity()
+              << " sendFrames " << SendFramePool::GetAllocatedCount() << "\n";
+    std::cout << "[Capacity] sessionBytes " << sessionBytes
+              << " roomBytes " << roomBytes
+              << " arenaBytes " << arenaBytes << ( isLargePages ? " (large pages)" : "" )
+              << " frameBytes " << frameBytes
+              << " total " << sessionBytes + roomBytes + arenaBytes + frameBytes << "\n";
+}
+
+
 void Network::Server::CreateListenSocket()
 {
     std::cout << "Create Listen Socket\n";
-    listenSocketHandle = socket( AF_INET, SOCK_STREAM, IPPROTO_TCP );
+    //     ŷ,  Ұ Ӽ ״ ޽ϴ.
+    DWORD flags = WSA_FLAG_NO_HANDLE_INHERIT;
+    if ( ioEngine == EIoEngine::RegisteredIo ) flags |= WSA_FLAG_OVERLAPPED | WSA_FLAG_REGISTERED_IO;
+    listenSocketHandle = WSASocket( AF_INET, SOCK_STREAM, IPPROTO_TCP, nullptr, 0, flags );
     if ( listenSocketHandle == INVALID_SOCKET )
     {
         PrintLastErrorMessageInFile( "CreateListen" );
@@ -219,6 +466,52 @@ void Network::Server::StartListen()
         exit( 0 );
     }
     ChangeNoneBlockingOption( listenSocketHandle, true );
+    poller.Initialize( listenSocketHandle );
+    if ( ioEngine == EIoEngine::RegisteredIo &&
+         !registeredIo.Initialize( listenSocketHandle, static_cast< UInt32 >( Constant::ServerMaxSessionCount ) ) )
+    {
+        exit( 0 );
+    }
+    if ( useIoThreads ) StartIoThreads();
+}
+
+
+void Network::Server::StartIoThreads()
+{
+    std::cout << "Start Io Threads : " << Constant::ServerIoThreadCount << "\n";
+    for ( Int32 i = 0; i < Constant::ServerIoThreadCount; i++ )
+    {
+        ioThreads.emplace_back( std::make_unique< IoThread >() );
+        ioThreads.back()->Start();
+    }
+}
+
+
+void Network::Server::ProcessIo()
+{
+    if ( udpChannel.IsOpened() )
+    {
+        udpChannel.Receive();
+        ioStatistics.systemCallCount += udpChannel.TakeSystemCallCount();
+    }
+    if ( useIoThreads )
+    {
+        ProcessIoThreads();
+        return;
+    }
+    switch ( ioEngine )
+    {
+        case EIoEngine::Poll :
+            Poll();
+            break;
+        case EIoEngine::RegisteredIo :
+            ProcessRegisteredIo();
+            break;
+        case EIoEngine::Select :
+        default :
+            Select();
+            break;
+    }
 }
 
 
@@ -235,7 +528,8 @@ void Network::Server::Select()
 
     for ( Session& session : sessions )
     {
-        FD_SET( session.GetSocket(), &read );
+        //  ѵ ɸ   ƽ ̾ ó   ʽϴ.
+        if ( !session.IsReceiveThrottled() ) FD_SET( session.GetSocket(), &read );
         FD_SET( session.GetSocket(), &except );
         if ( session.HasSendBytes() )
             FD_SET( session.GetSocket(), &write );
@@ -244,43 +538,25 @@ void Network::Server::Select()
     val.tv_sec = 0;
     val.tv_usec = 0;
     ResultCode selectResult = select( NULL, &read, &write, &except, &val ); // time == NULL :  ٸ
+    ioStatistics.systemCallCount++;
     if ( selectResult == SOCKET_ERROR )
         PrintLastErrorMessageInFile( "Select" );
 
     //Accept
-    if ( FD_ISSET( listenSocketHandle, &read ) )
-    {
-        SOCKET clientSocket;
-        SOCKADDR_IN clientAddr;
-        INT32 addrLength = sizeof( clientAddr );
-        clientSocket = accept( listenSocketHandle, ( SOCKADDR* )&clientAddr, &addrLength );
-        if ( clientSocket == INVALID_SOCKET )
-            PrintLastErrorMessageInFile( "Accept" );
-        else
-        {
-            char addressStringBuffer[ 512 ];
-            ZeroMemory( addressStringBuffer, sizeof( addressStringBuffer ) );
-            const char* addrString = inet_ntop( AF_INET, &clientAddr.sin_addr, addressStringBuffer, sizeof( addressStringBuffer ) );
-
-            UInt16 port = ntohs( clientAddr.sin_port );
-
-            Session& clientSession = AddNewSession( clientSocket );
-            clientSession.SetAddress( addrString, port );
-            clientSession.SetState( Session::EState::Wait );
-            clientSession.LogInput( "connected\n" );
-        }
-    }
+    if ( FD_ISSET( listenSocketHandle, &read ) ) AcceptPendingSessions();
     //Recv
     for ( Session& session : sessions )
     {
         if ( !FD_ISSET( session.GetSocket(), &read ) ) continue;
         session.ProcessReceive();
+        ioStatistics.systemCallCount++;
     }
     //Send
     for ( Session& session : sessions )
     {
         if ( !FD_ISSET( session.GetSocket(), &write ) ) continue;
         session.ProcessSend();
+        ioStatistics.systemCallCount++;
     }
     //Except
     for ( Session& session : sessions )
@@ -293,30 +569,372 @@ void Network::Server::Select()
 }
 
 
-void Network::Server::RemoveExpiredSession()
+void Network::Server::Poll()
+{
+    ResultCode readyCount = poller.Wait( 0 );
+    ioStatistics.systemCallCount++;
+    if ( readyCount == SOCKET_ERROR )
+    {
+        PrintLastErrorMessageInFile( "Poll" );
+        return;
+    }
+    if ( readyCount == 0 ) return;
+
+    //Accept
+    if ( poller.IsListenReady() ) AcceptPendingSessions();
+    //Recv, Send, Except
+    poller.VisitReady( readyCount,
+                      [this]( Session* session, Int16 revents )
+                      {
+                          if ( session->IsClosed() ) return;
+                          if ( revents & ( POLLRDNORM | POLLHUP ) )
+                          {
+                              session->ProcessReceive();
+                              ioStatistics.systemCallCount++;
+                          }
+                          if ( session->IsClosed() ) return;
+                          if ( revents & POLLWRNORM )
+                          {
+                              session->ProcessSend();
+                              ioStatistics.systemCallCount++;
+                          }
+                          if ( session->IsClosed() ) return;
+                          if ( revents & ( POLLERR | POLLNVAL ) )
+                          {
+                              session->Close();
+                              session->LogInput( "connection error" );
+                          }
+                      }
+                     );
+}
+
+
+void Network::Server::ProcessRegisteredIo()
+{
+    //Accept
+    AcceptPendingSessions();
+    //Recv, Send Ϸ ó
+    registeredIo.ProcessCompletions();
+    //Recv, Send û 
+    registeredIo.SubmitRequests();
+    ioStatistics.systemCallCount += registeredIo.TakeSystemCallCount();
+}
+
+
+void Network::Server::ProcessIoThreads()
 {
-    sessions.remove_if( []( Session& session )
+    // ̺Ʈ     Ȯؾ,  ̺Ʈ ̹   Ű ʽϴ.
+    auto releasedBegin = std::partition( expiredSessions.begin(),
+                                        expiredSessions.end(),
+                                        []( const Session* session )
+                                        {
+                                            return !session->IsIoReleased();
+                                        }
+                                       );
+    releasedSessions.insert( releasedSessions.end(), releasedBegin, expiredSessions.end() );
+    expiredSessions.erase( releasedBegin, expiredSessions.end() );
+
+    //Accept
+    AcceptPendingSessions();
+    //Recv, Except
+    for ( auto& ioThread : ioThreads )
+    {
+        ioThread->TakeEvents( receivedSessions, disconnectedSessions );
+        for ( Session* session : receivedSessions )
+        {
+            if ( !session->IsClosed() ) session->ProcessInbound();
+        }
+        for ( Session* session : disconnectedSessions )
+        {
+            if ( session->IsClosed() ) continue;
+            session->Close();
+            session->LogInput( "connection error" );
+        }
+        ioStatistics.systemCallCount += ioThread->TakeSystemCallCount();
+    }
+}
+
+
+void Network::Server::AcceptPendingSessions()
+{
+    //    ƽ   ʵ WSAEWOULDBLOCK ̳  ޽ϴ.
+    for ( Int32 i = 0; i < Constant::ServerAcceptBudgetPerTick; i++ )
+    {
+        if ( !AcceptNewSession() ) break;
+    }
+}
+
+
+Bool Network::Server::AcceptNewSession()
+{
+    SOCKET clientSocket;
+    SOCKADDR_IN clientAddr;
+    INT32 addrLength = sizeof( clientAddr );
+    clientSocket = accept( listenSocketHandle, ( SOCKADDR* )&clientAddr, &addrLength );
+    ioStatistics.systemCallCount++;
+    if ( clientSocket == INVALID_SOCKET )
+    {
+        if ( WSAGetLastError() != WSAEWOULDBLOCK ) PrintLastErrorMessageInFile( "Accept" );
+        return false;
+    }
+    else
+    {
+        char addressStringBuffer[ 512 ];
+        ZeroMemory( addressStringBuffer, sizeof( addressStringBuffer ) );
+        const char* addrString = inet_ntop( AF_INET, &clientAddr.sin_addr, addressStringBuffer, sizeof( addressStringBuffer ) );
+
+        UInt16 port = ntohs( clientAddr.sin_port );
+        if ( Constant::ServerTcpNoDelay )
+        {
+            // ƽ     Ƿ Nagle   ٸ ʿ䰡 ϴ.
+            BOOL isNoDelay = TRUE;
+            setsockopt( clientSocket, IPPROTO_TCP, TCP_NODELAY, reinterpret_cast< const char* >( &isNoDelay ), sizeof( isNoDelay ) );
+            ioStatistics.systemCallCount++;
+        }
+
+        Session* clientSession = AddNewSession( clientSocket );
+        if ( !clientSession )
+        {
+            //   á   ٷ ϴ.
+            printf_s( "%s:%d / session slots are full\n", addrString, port );
+            closesocket( clientSocket );
+            return true;
+        }
+        clientSession->SetAddress( addrString, port );
+        clientSession->SetState( Session::EState::Wait );
+        if ( !allocationCheckClients.empty() ) BindAllocationCheckClient( clientSession );
+        clientSession->LogInput( "connected\n" );
+        ioStatistics.acceptCount++;
+        return true;
+    }
+}
+
+
+void Network::Server::FlushStateLanes()
+{
+    // и  FlushStateLane ȿ stateLaneSessions  ٽ ϴ.
+    if ( stateLaneSessions.empty() ) return;
+    flushingStateSessions.swap( stateLaneSessions );
+    for ( Session* session : flushingStateSessions )
+    {
+        session->FlushStateLane();
+    }
+    flushingStateSessions.clear();
+}
+
+
+void Network::Server::FlushSessions()
+{
+    //  select/poll  ٸ ʰ ̹ ƽ  Ŷ ٷ ϴ.
+    for ( Session* session : pendingFlushSessions )
+    {
+        if ( session->IsClosed() ) continue;
+        if ( useIoThreads )
+        {
+            ioThreads[ session->GetIoThreadIndex() ]->PostWriteInterest( session );
+        }
+        else if ( ioEngine == EIoEngine::RegisteredIo )
+        {
+            registeredIo.MarkSendPending( session );
+        }
+        else
+        {
+            session->ProcessSend();
+            ioStatistics.systemCallCount++;
+            //       մϴ, select   Ʈ Ǵմϴ.
+            if ( ioEngine == EIoEngine::Poll && !session->IsClosed() && session->HasSendBytes() )
+                poller.SetWriteInterest( session, true );
+        }
+    }
+    pendingFlushSessions.clear();
+    // ť      Ƿ,    ƽ  Ǯ ϴ.
+    for ( Session* session : openFrameSessions )
+    {
+        session->ReleaseOpenFrame();
+    }
+    openFrameSessions.clear();
+    if ( ioEngine == EIoEngine::RegisteredIo )
+    {
+        registeredIo.SubmitRequests();
+        ioStatistics.systemCallCount += registeredIo.TakeSystemCallCount();
+    }
+}
+
+
+void Network::Server::ReportIoStatistics()
+{
+    ioStatistics.tickCount++;
+    auto now = std::chrono::system_clock::now();
+    TimeSecond elapsed = now - ioStatistics.reportTime;
+    if ( elapsed.count() < IoStatisticsReportSeconds ) return;
+
+    UInt64 cpuTime = GetProcessCpuTime();
+    Double cpuSeconds = static_cast< Double >( cpuTime - ioStatistics.reportCpuTime ) / 10000000.0;
+    Double cpuPercent = cpuSeconds / elapsed.count() * 100.0;
+    Double sessionCount = static_cast< Double >( sessions.GetCount() );
+    Double cpuPercentPerThousand = sessionCount > 0 ? cpuPercent * 1000.0 / sessionCount : 0.0;
+    Double callsPerTick = static_cast< Double >( ioStatistics.systemCallCount ) / ioStatistics.tickCount;
+    Double acceptsPerSecond = static_cast< Double >( ioStatistics.acceptCount ) / elapsed.count();
+    Double flushLatencyAverage = ioStatistics.flushCount > 0 ? ioStatistics.flushLatencySum / ioStatistics.flushCount : 0.0;
+    printf( "[IoStat] engine : %s / sessions : %zu / accepts per sec : %.2lf / syscalls per tick : %.2lf / cpu : %.2lf%% / cpu per 1000 players : %.2lf%% / input to flush : avg %.3lf ms, max %.3lf ms\n",
+           ToString( ioEngine ),
+           sessions.GetCount(),
+           acceptsPerSecond,
+           callsPerTick,
+           cpuPercent,
+           cpuPercentPerThousand,
+           flushLatencyAverage * 1000.0,
+           ioStatistics.flushLatencyMax * 1000.0
+          );
+
+    Game::SnapshotStatistics snapshotStatistics;
+    for ( Game::Room& room : rooms )
+    {
+        Game::SnapshotStatistics roomStatistics = room.TakeSnapshotStatistics();
+        snapshotStatistics.deltaBytes += roomStatistics.deltaBytes;
+        snapshotStatistics.objectLocationBytes += roomStatistics.objectLocationBytes;
+        snapshotStatistics.playerSeconds += roomStatistics.playerSeconds;
+    }
+    if ( snapshotStatistics.playerSeconds > 0.0 )
+    {
+        printf( "[SnapshotStat] delta snapshot : %.1lf bytes per player per sec / object location : %.1lf bytes per player per sec\n",
+               snapshotStatistics.deltaBytes / snapshotStatistics.playerSeconds,
+               snapshotStatistics.objectLocationBytes / snapshotStatistics.playerSeconds
+              );
+    }
+
+    UInt64 arenaAllocationCount = Game::RoomArena::TakeUpstreamAllocationCount();
+    printf( "[RoomPool] rooms : %llu / %u / high water : %llu / finished matches : %llu / arena heap allocations : %llu\n",
+           rooms.GetCount(),
+           rooms.GetCapacity(),
+           roomHighWaterCount,
+           finishedRoomCount,
+           arenaAllocationCount
+          );
+    finishedRoomCount = 0;
+    printf( "[FrameScratch] heap allocations : %llu\n", Game::FrameAllocator::TakeOverflowCount() );
+    printf( "[BufferPool] session buffers borrowed : %llu bytes / pooled : %llu bytes / per session : %zu bytes + borrowed\n",
+           BufferPool::GetBorrowedBytes(),
+           BufferPool::GetAllocatedBytes(),
+           sizeof( Session )
+          );
+
+    // ۽  и Ƽ  ٷ ݴϴ.
+    UInt64 supersededStateCount = 0;
+    UInt64 heldStateCount = 0;
+    UInt64 maxQueuedSendBytes = 0;
+    for ( Session& session : sessions )
+    {
+        supersededStateCount += session.TakeSupersededStateCount();
+        heldStateCount += session.TakeHeldStateCount();
+        maxQueuedSendBytes = std::max( maxQueuedSendBytes, session.GetQueuedSendBytes() );
+    }
+    printf( "[SendStat] superseded states : %llu / held state flushes : %llu / slow client closes : %llu / max queued : %llu bytes\n",
+           supersededStateCount,
+           heldStateCount,
+           ioStatistics.slowClientCloseCount,
+           maxQueuedSendBytes
+          );
+
+    //  ѵ ɸ  ݴϴ.
+    for ( Session& session : sessions )
+    {
+        UInt64 throttledCount = session.TakeThrottledCount();
+        if ( throttledCount == 0 ) continue;
+        printf( "[ThrottleStat] %s:%d / %s : %llu frames throttled\n",
+               session.GetAddress().c_str(),
+               session.GetPort(),
+               session.GetId().c_str(),
+               throttledCount
+              );
+    }
+
+    ioStatistics.reportTime = now;
+    ioStatistics.reportCpuTime = cpuTime;
+    ioStatistics.systemCallCount = 0;
+    ioStatistics.tickCount = 0;
+    ioStatistics.acceptCount = 0;
+    ioStatistics.flushCount = 0;
+    ioStatistics.flushLatencySum = 0.0;
+    ioStatistics.flushLatencyMax = 0.0;
+    ioStatistics.slowClientCloseCount = 0;
+}
+
+
+template < class Predicate >
+void Network::Server::RecycleSessions( Predicate&& predicate )
+{
+    // Ը   ü  ۸ մϴ, ִ ڵ 밡 ޶ ɷϴ.
+    sessions.ReleaseIf( [&predicate]( Session& session )
                        {
-                           return session.IsClosed();
+                           if ( !predicate( session ) ) return false;
+                           session.ReleaseSendFrames();
+                           return true;
                        }
                       );
 }
 
 
+void Network::Server::RemoveExpiredSession()
+{
+    if ( useIoThreads )
+    {
+        // I/O 尡  Ǹ ϴ.
+        if ( releasedSessions.empty() ) return;
+        RecycleSessions( [this]( const Session& session )
+                        {
+                            return std::find( releasedSessions.begin(), releasedSessions.end(), &session ) != releasedSessions.end();
+                        }
+                       );
+        releasedSessions.clear();
+        return;
+    }
+    if ( expiredSessions.empty() ) return;
+    for ( Session* session : expiredSessions )
+    {
+        poller.Unregister( session );
+        registeredIo.Unregister( session );
+    }
+    expiredSessions.clear();
+    RecycleSessions( []( const Session& session )
+                    {
+                        return session.IsClosed();
+                    }
+                   );
+}
+
+
 void Network::Server::RemoveExpiredRoom()
 {
-    rooms.remove_if( []( const Game::Room& room )
+    //    ʰ Ը  AddNewRoom  ٽ ϴ.
+    rooms.ReleaseIf( [this]( const Game::Room& room )
                     {
-                        return room.GetState() == Game::ERoomState::End;
+                        if ( room.GetState() != Game::ERoomState::End ) return false;
+                        finishedRoomCount++;
+                        return true;
                     }
                    );
 }
 
 
-Network::Session& Network::Server::AddNewSession( SocketHandle socket )
+Network::Session* Network::Server::AddNewSession( SocketHandle socket )
 {
-    sessions.emplace_back( socket, this );
-    return sessions.back();
+    SessionHandle handle = sessions.Acquire();
+    if ( handle == NullSessionHandle ) return nullptr;
+    Session* reusedSession = sessions.Get( handle );
+    if ( reusedSession ) reusedSession->Reset( socket );
+    Session& session = reusedSession ? *reusedSession : sessions.Emplace( handle, socket, this );
+    session.SetHandle( handle );
+    if ( useIoThreads )
+    {
+        //  κ I/O 忡 ѱϴ.
+        session.SetIoThreadIndex( nextIoThreadIndex );
+        ioThreads[ nextIoThreadIndex ]->PostRegister( &session );
+        nextIoThreadIndex = ( nextIoThreadIndex + 1 ) % static_cast< Int32 >( ioThreads.size() );
+    }
+    else if ( ioEngine == EIoEngine::Poll ) poller.Register( &session );
+    else if ( ioEngine == EIoEngine::RegisteredIo && !registeredIo.Register( &session ) ) session.Close();
+    return &session;
 }
 
 
@@ -337,7 +955,7 @@ void Network::Server::QueuingMatch()
                 packet.playerIndex = i;
                 readyMatch.users[ i ] = request.requester;
                 readyMatch.userReadys[ i ] = false;
-                request.requester->SendPacket( &packet );
+                if ( Session* session = FindSession( request.requester ) ) session->SendPacket( &packet );
                 matchQueue.pop_front();
             }
             std::cout << "Queueueueing 3 Element" << std::endl;
@@ -352,7 +970,7 @@ void Network::Server::QueuingMatch()
                 Packet::Server::ChangeMatchingInfo packet;
                 packet.currentUser = remainUser;
                 packet.maxUser = Constant::MaxUserCount;
-                req.requester->SendPacket( &packet );
+                if ( Session* session = FindSession( req.requester ) ) session->SendPacket( &packet );
             }
             return;
         }
@@ -373,14 +991,352 @@ void Network::Server::PostSessionClosed( Session* session )
 {
     this->CancelRequest( session );
     this->PostCancelReadyMatch( session );
+    expiredSessions.push_back( session );
+    throttledSessions.erase( std::remove( throttledSessions.begin(), throttledSessions.end(), session ), throttledSessions.end() );
+    if ( udpChannel.IsOpened() ) udpChannel.Unbind( session );
+    if ( useIoThreads ) ioThreads[ session->GetIoThreadIndex() ]->PostUnregister( session );
+}
+
+
+void Network::Server::PostSendPending( Session* session )
+{
+    // ƽ  FlushSessions  Ѳ ϴ.
+    pendingFlushSessions.push_back( session );
 }
 
 
-Game::Room& Network::Server::AddNewRoom( Int32 userCount )
+void Network::Server::PostOpenFrame( Session* session )
 {
-    rooms.emplace_back( userCount );
-    return rooms.back();
+    // ƽ  FlushSessions     ϴ.
+    openFrameSessions.push_back( session );
+}
+
+
+void Network::Server::PostStatePending( Session* session )
+{
+    stateLaneSessions.push_back( session );
+}
+
+
+void Network::Server::PostSlowClientClosed( Session* session )
+{
+    ioStatistics.slowClientCloseCount++;
+    printf( "[SendStat] slow client closed %s:%d / %llu bytes queued\n",
+           session->GetAddress().c_str(),
+           session->GetPort(),
+           session->GetQueuedSendBytes()
+          );
+}
+
+
+void Network::Server::PostUnreliablePending( Session* session )
+{
+    udpChannel.MarkPending( session );
+}
+
+
+void Network::Server::IssueUdpToken( Session* session )
+{
+    if ( !udpChannel.IsOpened() ) return;
+    Packet::Server::UdpToken packet;
+    packet.token = udpChannel.IssueToken( session );
+    packet.port = listenPort;
+    session->SendPacket( &packet );
+}
+
+
+void Network::Server::PostReceiveThrottled( Session* session )
+{
+    //  ƽ   ó  б ⸦ ϴ.
+    throttledSessions.push_back( session );
+    if ( ioEngine == EIoEngine::Poll && !useIoThreads ) poller.SetReadInterest( session, false );
+}
+
+
+void Network::Server::PostInboundDrained( Session* session )
+{
+    //     б ⸦ ش I/O 忡 ٽ մϴ.
+    if ( useIoThreads ) ioThreads[ session->GetIoThreadIndex() ]->PostReadInterest( session );
+}
+
+
+UInt64 Network::Server::GetTickIndex() const
+{
+    return tickIndex;
+}
+
+
+void Network::Server::ResumeThrottledSessions()
+{
+    // ó ߿ ٽ ѵ ɸ throttledSessions   ϴ.
+    if ( throttledSessions.empty() ) return;
+    resumingSessions.swap( throttledSessions );
+    for ( Session* session : resumingSessions )
+    {
+        if ( ioEngine == EIoEngine::Poll && !useIoThreads ) poller.SetReadInterest( session, true );
+        session->ResumeThrottledReceive();
+    }
+    resumingSessions.clear();
+}
+
+
+void Network::Server::PostSendDrained( Session* session )
+{
+    if ( ioEngine == EIoEngine::Poll ) poller.SetWriteInterest( session, false );
+}
+
+
+Network::Session* Network::Server::FindSession( SessionHandle handle )
+{
+    return sessions.Get( handle );
+}
+
+
+Game::Room* Network::Server::AddNewRoom( Int32 userCount )
+{
+    SlotHandle handle = rooms.Acquire();
+    if ( handle == NullSlotHandle ) return nullptr;
+    Game::Room* reusedRoom = rooms.Get( handle );
+    if ( reusedRoom ) reusedRoom->Reset();
+    Game::Room& room = reusedRoom ? *reusedRoom : rooms.Emplace( handle, userCount, this, Constant::ServerRoomSpecialized != 0 );
+    roomHighWaterCount = std::max< UInt64 >( roomHighWaterCount, rooms.GetCount() );
+    return &room;
+}
+
+
+void Network::Server::StartAllocationCheck()
+{
+    if ( Constant::ServerAllocationCheckRooms <= 0 ) return;
+    if ( !AllocationTracker::IsEnabled() )
+    {
+        std::cout << "[AllocCheck] ALLOCATION_TRACKING 尡 ƴϾ ˻ ʽϴ\n";
+        return;
+    }
+    allocationCheckRooms.resize( Constant::ServerAllocationCheckRooms, nullptr );
+    allocationCheckStates.resize( Constant::ServerAllocationCheckRooms, Game::ERoomState::Closed );
+    allocationCheckClients.resize( allocationCheckRooms.size() * Constant::MaxUserCount );
+    std::cout << "[AllocCheck] rooms " << allocationCheckRooms.size()
+              << " loopback sessions " << allocationCheckClients.size()
+              << " warmup " << Constant::ServerAllocationWarmupTicks
+              << " ticks " << Constant::ServerAllocationCheckTicks << "\n";
+}
+
+
+void Network::Server::UpdateAllocationCheck()
+{
+    //  渶  Ŭ̾Ʈ   ¿ ȸ      θ  մϴ.
+    //   2, 3  UDP   ־ ۽,  , , UDP ΰ  ˻翡 ϴ.
+    isAllocationCheckSteady = true;
+    for ( size_t r = 0; r < allocationCheckRooms.size(); r++ )
+    {
+        Game::Room*& room = allocationCheckRooms[ r ];
+        LoopbackClient* clients = &allocationCheckClients[ r * Constant::MaxUserCount ];
+        if ( !room )
+        {
+            isAllocationCheckSteady = false;
+            if ( !ConnectAllocationCheckClients( r ) ) continue;
+            room = AddNewRoom( Constant::MaxUserCount );
+            if ( !room ) continue;
+            for ( Int32 i = 0; i < Constant::MaxUserCount; i++ ) room->AddSession( i, FindSession( clients[ i ].session ) );
+            room->ReadyToGame();
+            for ( Int32 i = 0; i < Constant::MaxUserCount; i++ )
+            {
+                Session* session = FindSession( clients[ i ].session );
+                if ( clients[ i ].udpSocket != INVALID_SOCKET && session->GetUdpEndpoint().token != 0 )
+                    SendLoopbackToken( clients[ i ], listenPort, session->GetUdpEndpoint().token );
+            }
+        }
+        for ( Int32 i = 0; i < Constant::MaxUserCount; i++ )
+        {
+            if ( !DrainLoopbackClient( clients[ i ] ) )
+            {
+                //   ˻簡  Ƿ    ΰ ٽ մϴ.
+                CloseLoopbackClient( clients[ i ] );
+                isAllocationCheckSteady = false;
+                continue;
+            }
+            Packet::Client::Input input;
+            if ( MakeScriptedInput( tickIndex + r * 13 + i * 7, input ) ) SendLoopbackInput( clients[ i ], GetLoopbackVersion( i ), input );
+        }
+    }
+}
+
+
+Bool Network::Server::ConnectAllocationCheckClients( size_t roomIndex )
+{
+    //  ϳ  Ŭ̾Ʈ ӽŵϴ,   ޾   true Դϴ.
+    Bool isReady = true;
+    for ( Int32 i = 0; i < Constant::MaxUserCount; i++ )
+    {
+        LoopbackClient& client = allocationCheckClients[ roomIndex * Constant::MaxUserCount + i ];
+        Session* session = FindSession( client.session );
+        if ( client.session != NullSessionHandle && ( !session || session->IsClosed() ) ) CloseLoopbackClient( client );
+        if ( client.tcpSocket == INVALID_SOCKET )
+        {
+            if ( !ConnectLoopbackClient( client, listenPort, GetLoopbackVersion( i ), IsLoopbackUnreliable( i ) && udpChannel.IsOpened() ) )
+            {
+                PrintLastErrorMessageInFile( "LoopbackConnect" );
+                CloseLoopbackClient( client );
+            }
+            isReady = false;
+            continue;
+        }
+        session = FindSession( client.session );
+        isReady = isReady && session && session->GetProtocolVersion() == GetLoopbackVersion( i );
+    }
+    return isReady;
+}
+
+
+void Network::Server::BindAllocationCheckClient( Session* session )
+{
+    //  Ŭ̾Ʈ  Ʈ    ƮԴϴ.
+    for ( LoopbackClient& client : allocationCheckClients )
+    {
+        if ( client.tcpSocket == INVALID_SOCKET || client.session != NullSessionHandle ) continue;
+        if ( client.localPort != session->GetPort() ) continue;
+        client.session = session->GetHandle();
+        return;
+    }
+}
+
+
+void Network::Server::EndAllocationTick()
+{
+    if ( !AllocationTracker::IsEnabled() ) return;
+    EAllocationPhase worstPhase = EAllocationPhase::Other;
+    UInt64 allocationCount = AllocationTracker::EndTick( tickIndex, worstPhase );
+    if ( allocationCheckRooms.empty() ) return;
+
+    for ( size_t r = 0; r < allocationCheckRooms.size(); r++ )
+    {
+        Game::Room*& room = allocationCheckRooms[ r ];
+        if ( !room ) continue;
+        if ( room->GetState() != allocationCheckStates[ r ] )
+        {
+            allocationCheckStates[ r ] = room->GetState();
+            isAllocationCheckSteady = false;
+        }
+        //   ̹ Ǯ ưǷ  ƽ  ϴ.
+        if ( room->GetState() == Game::ERoomState::End ) room = nullptr;
+    }
+    if ( tickIndex <= static_cast< UInt64 >( Constant::ServerAllocationWarmupTicks ) ) return;
+    if ( !isAllocationCheckSteady ) return;
+
+    allocationCheckTickCount++;
+    if ( allocationCount > 0 )
+    {
+        allocationCheckFailedCount++;
+        std::cout << "[AllocCheck] tick " << tickIndex
+                  << " allocations " << allocationCount
+                  << " worst " << ToString( worstPhase ) << "\n";
+    }
+    if ( allocationCheckTickCount < static_cast< UInt64 >( Constant::ServerAllocationCheckTicks ) ) return;
+
+    Bool isFailed = allocationCheckFailedCount > 0;
+    std::cout << "[AllocCheck] " << ( isFailed ? "FAIL" : "PASS" )
+              << " steady ticks " << allocationCheckTickCount
+              << " allocating ticks " << allocationCheckFailedCount << "\n";
+    exit( isFailed ? 1 : 0 );
+}
+
+
+void Network::Server::RunRoomBenchmark()
+{
+    // ο    Է Ϲ  ο  ģ   ʴ ƽ  մϴ.
+    //  ð ù  ұ ǳʶپ 浹  ˻簡     ƽ ϴ.
+    // α״ ,     ĳÿ Ǯ        缭 ߾Ӱ ϴ.
+    constexpr Int32 repeatCount = 5;
+    const Int32 tickCount = Constant::ServerRoomBenchTicks;
+    const Double deltaTime = 1.0 / Constant::TickTerm;
+    auto measure = [this, tickCount, deltaTime]( Int32 userCount, Bool isSpecialized ) -> Double
+    {
+        auto room = std::make_unique< Game::Room >( userCount, this, isSpecialized );
+        room->MuteLog( true );
+        room->SeedRandom( static_cast< UInt32 >( userCount ) ); //  ġ   ϴ
+        for ( Int32 i = 0; i < userCount; i++ ) room->AddScriptedPlayer( i );
+        room->ReadyToGame();
+        room->SkipSeconds( Constant::GameFirstWaitSeconds + Constant::MapFirstDisableSeconds );
+        auto start = std::chrono::steady_clock::now();
+        for ( Int32 tick = 0; tick < tickCount; tick++ )
+        {
+            Game::FrameAllocator::Reset();
+            for ( Int32 i = 0; i < userCount; i++ )
+            {
+                Packet::Client::Input input;
+                if ( MakeScriptedInput( tick + i * 7, input ) ) room->OnScriptedInput( i, input );
+            }
+            room->Update( deltaTime );
+        }
+        TimeSecond elapsed = std::chrono::steady_clock::now() - start;
+        return tickCount / elapsed.count();
+    };
+    for ( Int32 userCount = 1; userCount <= Game::MaxPlayerCount; userCount++ )
+    {
+        measure( userCount, false );
+        measure( userCount, true );
+        std::array< Double, repeatCount > ticksPerSecond[ 2 ] = {};
+        for ( Int32 repeat = 0; repeat < repeatCount; repeat++ )
+        {
+            //     ʵ   ٲߴϴ.
+            Int32 first = repeat % 2;
+            ticksPerSecond[ first ][ repeat ] = measure( userCount, first != 0 );
+            ticksPerSecond[ 1 - first ][ repeat ] = measure( userCount, first == 0 );
+        }
+        std::sort( ticksPerSecond[ 0 ].begin(), ticksPerSecond[ 0 ].end() );
+        std::sort( ticksPerSecond[ 1 ].begin(), ticksPerSecond[ 1 ].end() );
+        Double generic = ticksPerSecond[ 0 ][ repeatCount / 2 ];
+        Double specialized = ticksPerSecond[ 1 ][ repeatCount / 2 ];
+        std::cout << "[RoomBench] players " << userCount
+                  << " ticks " << tickCount
+                  << " runs " << repeatCount
+                  << " generic median " << static_cast< UInt64 >( generic ) << "/s"
+                  << " best " << static_cast< UInt64 >( ticksPerSecond[ 0 ].back() ) << "/s"
+                  << " specialized median " << static_cast< UInt64 >( specialized ) << "/s"
+                  << " best " << static_cast< UInt64 >( ticksPerSecond[ 1 ].back() ) << "/s"
+                  << " speedup " << specialized / generic << "\n";
+    }
+    exit( 0 );
+}
+
+
+#ifdef SIMULATION_FIXED_POINT
+// ⺻ map.txt  VerifyDeterministicMatch   ⸦   GetStateHash Դϴ.
+//  Ģ̳ ⺻  ٲ  ޶ µ  Ĩϴ.
+constexpr UInt64 ExpectedMatchStateHash = 0x1dee11eaef2d7bdbULL;
+
+
+Bool Network::Server::VerifyDeterministicMatch()
+{
+    //   ۰   Է̸ , ð, ռ     °   ƾ մϴ.
+    //     Ⱑ  °  ⿡  ʴ Բ ϴ.
+    Bool isSame = true;
+    for ( Int32 run = 0; run < 2; run++ )
+    {
+        auto room = std::make_unique< Game::Room >( Constant::MaxUserCount, this );
+        for ( Int32 i = 0; i < Constant::MaxUserCount; i++ ) room->AddScriptedPlayer( i );
+        room->ReadyToGame();
+        for ( UInt64 tick = 0; room->GetState() != Game::ERoomState::End; tick++ )
+        {
+            Game::FrameAllocator::Reset();
+            for ( Int32 i = 0; i < Constant::MaxUserCount; i++ )
+            {
+                Packet::Client::Input input;
+                if ( MakeScriptedInput( tick + i * 7, input ) ) room->OnScriptedInput( i, input );
+            }
+            room->Update( 0 );
+        }
+        UInt64 hash = room->GetStateHash();
+        printf( "[Determinism] run %d state hash : %016llx / %016llx %s\n",
+                run,
+                hash,
+                ExpectedMatchStateHash,
+                hash == ExpectedMatchStateHash ? "PASS" : "FAIL" );
+        isSame = isSame && hash == ExpectedMatchStateHash;
+    }
+    return isSame;
 }
+#endif
 
 
 void Network::Server::ChangeNoneBlockingOption( SocketHandle Socket, Bool IsNoneBlocking )
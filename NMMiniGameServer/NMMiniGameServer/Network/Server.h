@@ -12,8 +12,13 @@
 #pragma once
 #include "Define/DataTypes.h"
 #include "Define/MapData.h"
+#include "Game/RoomState.h"
 #include "Network/Session.h"
 #include "Network/GameTimer.h"
+#include "Network/IoThread.h"
+#include "Network/Poller.h"
+#include "Network/RegisteredIo.h"
+#include "Network/UdpChannel.h"
 #include <array>
 #include <list>
 #include <memory>
@@ -30,10 +35,45 @@ namespace Game
 
 namespace Network
 {
+    enum class EIoEngine : Int32
+    {
+        Select,
+        Poll,
+        RegisteredIo,
+    };
+
+    inline const char* ToString( EIoEngine e )
+    {
+        switch ( e )
+        {
+            case EIoEngine::Select :
+                return "Select";
+            case EIoEngine::Poll :
+                return "Poll";
+            case EIoEngine::RegisteredIo :
+                return "RegisteredIo";
+            default :
+                return "unknown";
+        }
+    }
+
+    struct IoStatistics
+    {
+        std::chrono::system_clock::time_point reportTime;
+        UInt64 reportCpuTime = 0; // 100ns 
+        UInt64 systemCallCount = 0;
+        UInt64 tickCount = 0;
+        UInt64 acceptCount = 0;
+        UInt64 flushCount = 0;
+        Double flushLatencySum = 0.0; // ƽ    ź ƽ  ۽ű,  
+        Double flushLatencyMax = 0.0;
+        UInt64 slowClientCloseCount = 0;
+    };
+
     struct RequestMatch
     {
         std::chrono::system_clock::time_point reqTime;
-        Session* requester = nullptr;
+        SessionHandle requester = NullSessionHandle;
     };
 
     struct ReadyMatch
@@ -41,21 +81,57 @@ namespace Network
         std::chrono::system_clock::time_point reqTime;
         Int32 userCount = Constant::MaxUserCount;
         std::vector< bool > userReadys;
-        std::vector< Session* > users;
+        std::vector< SessionHandle > users;
         ReadyMatch();
     };
 
+    // Ҵ ˻  ÷̾,   Ʈ   Ŭ̾Ʈ   θ žϴ.
+    struct LoopbackClient
+    {
+        SocketHandle tcpSocket = INVALID_SOCKET;
+        SocketHandle udpSocket = INVALID_SOCKET;
+        UInt16 localPort = 0; //     Ʈ   ãϴ
+        SessionHandle session = NullSessionHandle;
+    };
+
     class Server
     {
     private:
         UInt16 listenPort = 0;
         SocketHandle listenSocketHandle = 0;
-        std::list< Game::Room > rooms;
-        std::list< Session > sessions;
+        SlotMap< Game::Room > rooms; //   Ը   Ī ٽ ϴ
+        UInt64 roomHighWaterCount = 0;
+        UInt64 finishedRoomCount = 0; //  ֱ    
+        SlotMap< Session > sessions; //    ° մϴ
         std::list< RequestMatch > matchQueue;
         std::list< ReadyMatch > readyMatches;
+        std::vector< Session* > expiredSessions;
+        std::vector< Session* > releasedSessions;
+        std::vector< Session* > pendingFlushSessions;
+        std::vector< Session* > openFrameSessions; // ̹ ƽ  ۽   
+        std::vector< Session* > throttledSessions; //  ѵ Ѿ  ƽ ̾ ó 
+        std::vector< Session* > resumingSessions;
+        std::vector< Session* > stateLaneSessions; //  ο   ִ 
+        std::vector< Session* > flushingStateSessions;
+        UInt64 tickIndex = 0;
         bool turnOnMatch = false;
         GameTimer timer;
+        EIoEngine ioEngine = EIoEngine::Select;
+        Poller poller;
+        RegisteredIo registeredIo;
+        UdpChannel udpChannel;
+        IoStatistics ioStatistics;
+        Bool useIoThreads = false;
+        Int32 nextIoThreadIndex = 0;
+        std::vector< std::unique_ptr< IoThread > > ioThreads;
+        std::vector< Session* > receivedSessions;
+        std::vector< Session* > disconnectedSessions;
+        std::vector< Game::Room* > allocationCheckRooms; //  Ŭ̾Ʈ Է ִ  
+        std::vector< LoopbackClient > allocationCheckClients; // 渶 MaxUserCount 
+        std::vector< Game::ERoomState > allocationCheckStates;
+        Bool isAllocationCheckSteady = false; //    ų ° ٲ ƽ ˻翡 ϴ
+        UInt64 allocationCheckTickCount = 0;
+        UInt64 allocationCheckFailedCount = 0;
     public:
         Server();
         ~Server();
@@ -66,18 +142,52 @@ namespace Network
         void PostReadyMatch( Session* requester );
         void PostCancelReadyMatch( Session* requester );
         void PostSessionClosed( Session* session );
+        void PostSendPending( Session* session );
+        void PostOpenFrame( Session* session );
+        void PostSendDrained( Session* session );
+        void PostReceiveThrottled( Session* session );
+        void PostInboundDrained( Session* session );
+        void PostStatePending( Session* session );
+        void PostSlowClientClosed( Session* session );
+        UInt64 GetTickIndex() const;
+        void PostUnreliablePending( Session* session );
+        void IssueUdpToken( Session* session );
+        Session* FindSession( SessionHandle handle );
     private:
         void InitializeSocket();
+        void PreallocateCapacity();
         void CreateListenSocket();
         void BindListenSocket();
         void StartListen();
+        void ProcessIo();
         void Select();
+        void Poll();
+        void ProcessRegisteredIo();
+        void ProcessIoThreads();
+        void StartIoThreads();
+        void AcceptPendingSessions();
+        Bool AcceptNewSession();
+        void FlushStateLanes();
+        void FlushSessions();
+        void ResumeThrottledSessions();
+        void ReportIoStatistics();
         void RemoveExpiredSession();
+        template < class Predicate >
+        void RecycleSessions( Predicate&& predicate );
         void RemoveExpiredRoom( );
-        Session& AddNewSession( SocketHandle socket );
+        Session* AddNewSession( SocketHandle socket );
         void QueuingMatch();
         void UpdateRooms( Double deltaTime );
-        Game::Room& AddNewRoom( Int32 userCount );
+        Game::Room* AddNewRoom( Int32 userCount );
+        void StartAllocationCheck();
+        void UpdateAllocationCheck();
+        Bool ConnectAllocationCheckClients( size_t roomIndex );
+        void BindAllocationCheckClient( Session* session );
+        void EndAllocationTick();
+        void RunRoomBenchmark();
+#ifdef SIMULATION_FIXED_POINT
+        Bool VerifyDeterministicMatch();
+#endif
 
         static void ChangeNoneBlockingOption( SocketHandle Socket, Bool IsNoneBlocking );
     };
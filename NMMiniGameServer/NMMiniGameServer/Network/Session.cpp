@@ -10,6 +10,7 @@
 
 
 #include "Network/Session.h"
+#include "Network/BufferPool.h"
 #include "Network/UtillFuntions.h"
 #include "Network/Server.h"
 #include "Define/PacketDefine.h"
@@ -17,13 +18,94 @@
 #include <WinSock2.h>
 #include <iostream>
 #include <array>
+#include <algorithm>
+
+
+//  2  Size  UInt16 ̶ ̸δ ѵ Ƿ,  ũⰡ packetScratch   մϴ.
+static_assert( Packet::GetMaxClientFrameSize() <= Network::Session::MaxPacketSize, "packetScratch   ū Ŭ̾Ʈ Ӻ ۽ϴ" );
+
+
+namespace
+{
+    //    ĭ,   Ű  °   ڸ ϴ.
+    struct StateLaneSlot
+    {
+        Packet::EType type;
+        UInt16 size;
+        Int32 key;
+        Byte data[ Network::Session::StateLaneSlotSize - 8 ];
+    };
+
+    static_assert( sizeof( StateLaneSlot ) == Network::Session::StateLaneSlotSize, "StateLaneSlot size" );
+
+    // Ű   ̸ ϴ,  â  Press -> Release   ޵˴ϴ.
+    void LatchInputState( Packet::EInputState& earlier, Packet::EInputState& latest, Packet::EInputState state )
+    {
+        if ( state == Packet::EInputState::None ) return;
+        if ( earlier == Packet::EInputState::None )
+        {
+            earlier = state;
+            return;
+        }
+        if ( latest != Packet::EInputState::None ) earlier = latest;
+        latest = state;
+    }
+}
 
 
 Network::Session::Session( SocketHandle socket, class Server* server )
-    : socket( socket ), port( 0 ), server( server )
+    : socket( socket ), readBuffer( ReceiveBufferSize ), sendQueue( SendQueueSize ), port( 0 ), protocolVersion( Packet::ProtocolVersion1 ), server( server )
+{
+    ResetReceiveTokens();
+}
+
+
+Network::Session::~Session()
+{
+    ReleaseSendFrames();
+}
+
+
+void Network::Session::Reset( SocketHandle socket )
+{
+    // Ǯ     մϴ, ۴ ٽ Ҵ ʽϴ.
+    this->socket = socket;
+    handle = NullSessionHandle;
+    readBuffer.Clear();
+    ReleaseSendFrames();
+    id.clear();
+    addressText.clear();
+    port = 0;
+    ioIndex = NullIoIndex;
+    ioThreadIndex = NullIoIndex;
+    isInboundNotified = false;
+    isInboundPaused = false;
+    isSendArmed = false;
+    isIoReleased = true;
+    udpEndpoint.token = 0;
+    udpEndpoint.isBound = false;
+    udpEndpoint.payload.clear();
+    protocolVersion = Packet::ProtocolVersion1;
+    ResetReceiveTokens();
+    state = EState::Wait;
+    contoller = nullptr;
+    room = nullptr;
+}
+
+
+void Network::Session::ReleaseSendFrames()
 {
-    readBuffer.resize( 1024 );
-    sendBuffer.resize( 1024 );
+    while ( !sendQueue.IsEmpty() )
+    {
+        SendFramePool::Release( sendQueue.At( 0 ).frame );
+        sendQueue.Pop();
+    }
+    sendQueue.ReleaseIfEmpty();
+    SendFramePool::Release( openFrame );
+    openFrame = nullptr;
+    queuedSendBytes = 0;
+    sendOverLimitTick = 0;
+    ReleaseStateLane();
 }
 
 
@@ -33,9 +115,21 @@ SocketHandle Network::Session::GetSocket() const
 }
 
 
+Network::SessionHandle Network::Session::GetHandle() const
+{
+    return handle;
+}
+
+
+void Network::Session::SetHandle( SessionHandle handle )
+{
+    this->handle = handle;
+}
+
+
 Bool Network::Session::HasSendBytes() const
 {
-    return sendBytes;
+    return !sendQueue.IsEmpty();
 }
 
 
@@ -47,69 +141,426 @@ void Network::Session::SetState( EState state )
 
 void Network::Session::ProcessSend()
 {
-    Int32 sentBytes = send( socket, ( const char* )sendBuffer.data(), sendBytes, 0 );
-    if ( sentBytes == SOCKET_ERROR )
+    WSABUF segments[ MaxGatherCount ];
+    Int32 segmentCount = GatherSendSegments( segments );
+    if ( segmentCount == 0 ) return;
+    DWORD sentBytes = 0;
+    ResultCode sendResult = WSASend( socket, segments, segmentCount, &sentBytes, 0, nullptr, nullptr );
+    if ( sendResult == SOCKET_ERROR )
     {
+        if ( WSAGetLastError() == WSAEWOULDBLOCK ) return;
         PrintLastErrorMessage( "send", __FILE__, __LINE__ );
         Close();
     }
     else
     {
-        //޸ 
-        memcpy_s( sendBuffer.data(), sendBytes - sentBytes, sendBuffer.data() + sentBytes, sendBytes - sentBytes );
-        sendBytes -= sentBytes;
+        ConsumeSendBytes( sentBytes );
     }
 }
 
 
 void Network::Session::ProcessReceive()
 {
-    // ̸ ļ ú  ۼ
-    Int32 receivedBytes = recv( socket,
-                               reinterpret_cast< char* >( readBuffer.data() ) + recvBytes,
-                               readBuffer.size() * sizeof( Byte ) - recvBytes,
-                               0
-                              );
-    Char* expectEnd = reinterpret_cast< Char* >( readBuffer.data() + recvBytes + receivedBytes - 1 );
-    if ( receivedBytes == 0 || receivedBytes == SOCKET_ERROR ) Close();
-    else
+    // б ۰   ̹ ƽ     ϴ.
+    if ( readBuffer.GetWritableBytes() == 0 ) return;
+    Int32 receivedBytes = ReceiveIntoBuffer();
+    if ( receivedBytes == 0 || ( receivedBytes == SOCKET_ERROR && WSAGetLastError() != WSAEWOULDBLOCK ) ) Close();
+    else ParseReceivedBytes();
+}
+
+
+void Network::Session::OnReceiveCompleted( const Byte* data, UInt64 size )
+{
+    // RIO  ϵ ۷   Ϸ  Ѱݴϴ.
+    // ޱ⸦    ŭ Ƿ   Ʈ ߳ ̶ ϴ.
+    if ( !readBuffer.Write( data, size ) )
+    {
+        LogInput( "receive buffer overflow, closed\n" );
+        Close();
+        return;
+    }
+    ParseReceivedBytes();
+}
+
+
+UInt64 Network::Session::GetReceivableBytes() const
+{
+    return readBuffer.GetWritableBytes();
+}
+
+
+UInt64 Network::Session::PeekSendBytes( Byte* destination, UInt64 capacity ) const
+{
+    UInt64 copiedBytes = 0;
+    UInt64 entryCount = sendQueue.GetCount();
+    for ( UInt64 i = 0; i < entryCount && copiedBytes < capacity; i++ )
+    {
+        const SendEntry& entry = sendQueue.At( i );
+        UInt64 length = std::min< UInt64 >( entry.end - entry.begin, capacity - copiedBytes );
+        memcpy_s( destination + copiedBytes, capacity - copiedBytes, entry.frame->data.data() + entry.begin, length );
+        copiedBytes += length;
+    }
+    return copiedBytes;
+}
+
+
+void Network::Session::ConsumeSendBytes( UInt64 size )
+{
+    PopSentBytes( size );
+    if ( !sendQueue.IsEmpty() ) return;
+    isSendArmed = false;
+    if ( server ) server->PostSendDrained( this );
+}
+
+
+Bool Network::Session::ReceiveInbound()
+{
+    // I/O 忡 ȣ, б  Դϴ.
+    if ( readBuffer.GetWritableBytes() == 0 ) return true;
+    Int32 receivedBytes = ReceiveIntoBuffer();
+    if ( receivedBytes == 0 ) return false;
+    if ( receivedBytes == SOCKET_ERROR ) return WSAGetLastError() == WSAEWOULDBLOCK;
+    return true;
+}
+
+
+Bool Network::Session::SendOutbound( Bool& hasRemainBytes )
+{
+    // I/O 忡 ȣ, ۽  ҺԴϴ.
+    hasRemainBytes = false;
+    WSABUF segments[ MaxGatherCount ];
+    Int32 segmentCount = GatherSendSegments( segments );
+    if ( segmentCount == 0 ) return true;
+    DWORD sentBytes = 0;
+    ResultCode sendResult = WSASend( socket, segments, segmentCount, &sentBytes, 0, nullptr, nullptr );
+    if ( sendResult == SOCKET_ERROR )
+    {
+        hasRemainBytes = true;
+        return WSAGetLastError() == WSAEWOULDBLOCK;
+    }
+    PopSentBytes( sentBytes );
+    if ( !sendQueue.IsEmpty() )
+    {
+        hasRemainBytes = true;
+        return true;
+    }
+    isSendArmed = false;
+    //   SendByte  ä  Ƿ ٽ Ȯմϴ.
+    hasRemainBytes = !sendQueue.IsEmpty() && !isSendArmed.exchange( true );
+    return true;
+}
+
+
+Bool Network::Session::MarkInboundNotified()
+{
+    // ̹ ˸  ̸ false, ùķ̼ 忡    ޵ǵ մϴ.
+    return !isInboundNotified.exchange( true );
+}
+
+
+Bool Network::Session::PauseInboundIfFull()
+{
+    // I/O 忡 ȣ,   á ùķ̼ 尡   б ⸦ ϴ.
+    if ( readBuffer.GetWritableBytes() != 0 ) return false;
+    isInboundPaused = true;
+    return true;
+}
+
+
+void Network::Session::ResumeInboundIfDrained()
+{
+    // ùķ̼ 忡 ȣ,  ڸ  I/O 忡 б ⸦ ٽ Ѵ޶ ûմϴ.
+    if ( !isInboundPaused || readBuffer.GetWritableBytes() == 0 ) return;
+    if ( isInboundPaused.exchange( false ) && server ) server->PostInboundDrained( this );
+}
+
+
+void Network::Session::ProcessInbound()
+{
+    // ùķ̼ 忡 ȣ, б  ҺԴϴ.
+    isInboundNotified = false;
+    ParseReceivedBytes();
+    ResumeInboundIfDrained();
+}
+
+
+void Network::Session::ResumeThrottledReceive()
+{
+    //  ƽ  ȣմϴ, ĵ Է   óϰ   ̾ óմϴ.
+    isReceiveThrottled = false;
+    if ( IsClosed() ) return;
+    RefillReceiveTokens();
+    if ( hasPendingInput )
+    {
+        hasPendingInput = false;
+        if ( contoller ) contoller->OnReceivedPacket( &pendingInput.header );
+        if ( hasLatestInput && contoller ) contoller->OnReceivedPacket( &latestInput.header );
+        hasLatestInput = false;
+    }
+    ParseReceivedBytes();
+    ResumeInboundIfDrained();
+}
+
+
+UInt64 Network::Session::TakeThrottledCount()
+{
+    UInt64 count = throttledCount;
+    throttledCount = 0;
+    return count;
+}
+
+
+Bool Network::Session::IsReceiveThrottled() const
+{
+    return isReceiveThrottled;
+}
+
+
+void Network::Session::ResetReceiveTokens()
+{
+    receiveByteTokens = static_cast< UInt64 >( Constant::ServerReceiveBytesPerTick ) * Constant::ServerReceiveBurstTicks;
+    receivePacketTokens = static_cast< UInt64 >( Constant::ServerReceivePacketsPerTick ) * Constant::ServerReceiveBurstTicks;
+    receiveRefillTick = server ? server->GetTickIndex() : 0;
+    isReceiveThrottled = false;
+    hasPendingInput = false;
+    hasLatestInput = false;
+    throttledCount = 0;
+}
+
+
+void Network::Session::RefillReceiveTokens()
+{
+    //  ƽ ŭ ä BurstTicks ƽ з  ʽϴ.
+    UInt64 tick = server ? server->GetTickIndex() : 0;
+    if ( tick <= receiveRefillTick ) return;
+    UInt64 elapsedTicks = std::min< UInt64 >( tick - receiveRefillTick, Constant::ServerReceiveBurstTicks );
+    receiveRefillTick = tick;
+    receiveByteTokens = std::min< UInt64 >( receiveByteTokens + elapsedTicks * Constant::ServerReceiveBytesPerTick,
+                                           static_cast< UInt64 >( Constant::ServerReceiveBytesPerTick ) * Constant::ServerReceiveBurstTicks );
+    receivePacketTokens = std::min< UInt64 >( receivePacketTokens + elapsedTicks * Constant::ServerReceivePacketsPerTick,
+                                             static_cast< UInt64 >( Constant::ServerReceivePacketsPerTick ) * Constant::ServerReceiveBurstTicks );
+}
+
+
+Bool Network::Session::TakeReceiveTokens( UInt64 size )
+{
+    if ( receivePacketTokens == 0 || receiveByteTokens < size ) return false;
+    receivePacketTokens--;
+    receiveByteTokens -= size;
+    return true;
+}
+
+
+void Network::Session::CoalesceInput( const Packet::Header* data )
+{
+    // Ű ռ ̴ pendingInput,  ̴ latestInput     Է  ʽϴ.
+    const Packet::Client::Input* input = reinterpret_cast< const Packet::Client::Input* >( data );
+    if ( !hasPendingInput )
+    {
+        pendingInput = *input;
+        latestInput = *input;
+        latestInput.left = latestInput.right = latestInput.rush = Packet::EInputState::None;
+        hasPendingInput = true;
+        hasLatestInput = false;
+        return;
+    }
+    LatchInputState( pendingInput.left, latestInput.left, input->left );
+    LatchInputState( pendingInput.right, latestInput.right, input->right );
+    LatchInputState( pendingInput.rush, latestInput.rush, input->rush );
+    hasLatestInput = latestInput.left != Packet::EInputState::None ||
+                     latestInput.right != Packet::EInputState::None ||
+                     latestInput.rush != Packet::EInputState::None;
+}
+
+
+void Network::Session::MarkReceiveThrottled()
+{
+    throttledCount++;
+    if ( isReceiveThrottled ) return;
+    isReceiveThrottled = true;
+    if ( server ) server->PostReceiveThrottled( this );
+}
+
+
+Int32 Network::Session::ReceiveIntoBuffer()
+{
+    //         ޽ϴ.
+    //    ,    EndWrite  ٷ ݴϴ.
+    WSABUF segments[ RingBuffer::MaxSegmentCount ];
+    readBuffer.BeginWrite();
+    Int32 segmentCount = readBuffer.GetWriteSegments( segments );
+    DWORD receivedBytes = 0;
+    DWORD flags = 0;
+    ResultCode receiveResult = segmentCount == 0 ? SOCKET_ERROR :
+                               WSARecv( socket, segments, segmentCount, &receivedBytes, &flags, nullptr, nullptr );
+    if ( receiveResult != SOCKET_ERROR ) readBuffer.CommitWrite( receivedBytes );
+    readBuffer.EndWrite();
+    if ( receiveResult == SOCKET_ERROR ) return SOCKET_ERROR;
+    return static_cast< Int32 >( receivedBytes );
+}
+
+
+Bool Network::Session::PushSendEntry( SendFrame* frame, UInt32 begin, UInt32 end )
+{
+    frame->AddReference();
+    SendEntry entry;
+    entry.frame = frame;
+    entry.begin = begin;
+    entry.end = end;
+    // Һڰ     ʵ ֱ  մϴ.
+    queuedSendBytes.fetch_add( end - begin, std::memory_order_acq_rel );
+    if ( sendQueue.Push( entry ) ) return UpdateSendBackpressure();
+    queuedSendBytes.fetch_sub( end - begin, std::memory_order_acq_rel );
+    SendFramePool::Release( frame );
+    // ť ġ  ϴ Ŭ̾Ʈ  ϴ.
+    LogInput( "send queue overflow\n" );
+    Close();
+    return false;
+}
+
+
+Int32 Network::Session::GatherSendSegments( WSABUF* segments ) const
+{
+    //  ӿ ̾  ϳ WSABUF  Ĩϴ.
+    Int32 segmentCount = 0;
+    UInt64 entryCount = sendQueue.GetCount();
+    for ( UInt64 i = 0; i < entryCount; i++ )
+    {
+        const SendEntry& entry = sendQueue.At( i );
+        char* begin = reinterpret_cast< char* >( entry.frame->data.data() + entry.begin );
+        ULONG length = entry.end - entry.begin;
+        if ( segmentCount > 0 && segments[ segmentCount - 1 ].buf + segments[ segmentCount - 1 ].len == begin )
+        {
+            segments[ segmentCount - 1 ].len += length;
+            continue;
+        }
+        if ( segmentCount == MaxGatherCount ) break;
+        segments[ segmentCount ].buf = begin;
+        segments[ segmentCount ].len = length;
+        segmentCount++;
+    }
+    return segmentCount;
+}
+
+
+void Network::Session::PopSentBytes( UInt64 size )
+{
+    queuedSendBytes.fetch_sub( size, std::memory_order_acq_rel );
+    while ( size > 0 )
+    {
+        SendEntry& entry = sendQueue.At( 0 );
+        UInt64 length = entry.end - entry.begin;
+        if ( size < length )
+        {
+            entry.begin += static_cast< UInt32 >( size );
+            return;
+        }
+        size -= length;
+        SendFramePool::Release( entry.frame );
+        sendQueue.Pop();
+    }
+    sendQueue.ReleaseIfEmpty();
+}
+
+
+void Network::Session::ParseReceivedBytes()
+{
+    //      ˻ϰ, ϳ ߸Ǹ ó ʰ ϴ.
+    while ( !IsClosed() )
+    {
+        UInt64 batchBytes = 0;
+        if ( !ValidateReceivedBytes( batchBytes ) )
+        {
+            LogInput( "malformed packet\n" );
+            Close();
+            break;
+        }
+        if ( batchBytes == 0 ) break;
+        if ( !DispatchReceivedBytes( batchBytes ) ) break;
+    }
+    //  ó   Ǯ ݴϴ,      ϴ.
+    readBuffer.ReleaseIfEmpty();
+}
+
+
+Bool Network::Session::ValidateReceivedBytes( UInt64& batchBytes ) const
+{
+    //    ũ ٸ ٷ źմϴ.
+    // Hello   Ӻ   ٲٹǷ ű⼭  ϴ.
+    UInt64 headerSize = Packet::GetHeaderSize( protocolVersion );
+    UInt64 readableBytes = readBuffer.GetReadableBytes();
+    Byte headerBytes[ sizeof( Packet::HeaderV2 ) ];
+    batchBytes = 0;
+    while ( readableBytes - batchBytes >= headerSize )
     {
-        recvBytes += receivedBytes;
-        //LogInput("Packet Recv\n");
+        readBuffer.Peek( headerBytes, headerSize, batchBytes );
+        Packet::EType type = Packet::GetPacketType( headerBytes, protocolVersion );
+        UInt64 packetSize = Packet::GetPacketSize( headerBytes, protocolVersion );
+        if ( packetSize == 0 || packetSize > MaxPacketSize ) return false;
+        if ( packetSize != Packet::GetClientFrameSize( type, protocolVersion ) ) return false;
+        if ( packetSize > readableBytes - batchBytes ) break; //  Ͱ  
+        batchBytes += packetSize;
+        if ( type == Packet::EType::ClientHello ) break;
+    }
+    return true;
+}
 
-        Byte* dataBegin = readBuffer.data();
-        Byte* csr = dataBegin;
-        Byte* dataEnd = readBuffer.data() + recvBytes;
 
-        while ( csr != dataEnd )
+Bool Network::Session::DispatchReceivedBytes( UInt64 batchBytes )
+{
+    //  ѵ  Է ĵΰ,  ۿ   ƽ ̾ óմϴ.
+    Byte headerBytes[ sizeof( Packet::HeaderV2 ) ];
+    UInt64 headerSize = Packet::GetHeaderSize( protocolVersion );
+    RefillReceiveTokens();
+    while ( batchBytes > 0 && !IsClosed() )
+    {
+        readBuffer.Peek( headerBytes, headerSize );
+        UInt64 packetSize = Packet::GetPacketSize( headerBytes, protocolVersion );
+        //  Ѿ Ŷ ̾ 纻 ó
+        const Packet::Header* headerPtr = nullptr;
+        if ( protocolVersion < Packet::ProtocolVersion2 )
+        {
+            headerPtr = reinterpret_cast< const Packet::Header* >( readBuffer.PeekContiguous( packetSize, packetScratch.data() ) );
+        }
+        else
+        {
+            // Ŭ̾Ʈ Ŷ   1  Ƿ  Ʈ ڿ  1   ѱϴ.
+            readBuffer.Peek( packetScratch.data(), packetSize );
+            packetScratch[ 1 ] = static_cast< Byte >( packetSize - 1 );
+            headerPtr = reinterpret_cast< const Packet::Header* >( packetScratch.data() + 1 );
+        }
+        //Ŷ ó
+        if ( TakeReceiveTokens( packetSize ) )
         {
-            const Packet::Header* headerPtr = reinterpret_cast< Packet::Header* >( csr );
-            if ( headerPtr->Size > recvBytes ) //  Ͱ  
-                break;
-            // ϸ
-            //Ŷ ó
             if ( contoller ) contoller->OnReceivedPacket( headerPtr );
             else OnReceivedPacketInWaitting( headerPtr );
-
-            //Ŀ ̵
-            csr += headerPtr->Size;
-            recvBytes -= headerPtr->Size;
         }
-        if ( csr != dataBegin && csr != dataEnd )
+        else if ( contoller && headerPtr->Type == Packet::EType::ClientInput )
         {
-            Int32 remainDatas = dataEnd - csr;
-            memcpy_s( dataBegin, remainDatas, csr, remainDatas );
+            CoalesceInput( headerPtr );
+            MarkReceiveThrottled();
         }
+        else
+        {
+            MarkReceiveThrottled();
+            return false;
+        }
+
+        //Ŀ ̵
+        readBuffer.Consume( packetSize );
+        batchBytes -= packetSize;
     }
+    return batchBytes == 0;
 }
 
 
 void Network::Session::Close()
 {
-    if ( socket == 0 ) return;
-    closesocket( this->socket );
+    if ( socket == 0 || IsClosed() ) return;
+    // I/O     Ͽ   I/O 尡 ݽϴ.
+    if ( ioThreadIndex == NullIoIndex ) closesocket( this->socket );
     SetState( EState::Closed );
-    if ( contoller ) contoller->SetSession( nullptr );
+    if ( contoller ) contoller->SetSession( NullSessionHandle );
     if( server )server->PostSessionClosed( this );
 }
 
@@ -151,6 +602,55 @@ void Network::Session::ClearRoomData()
 }
 
 
+Int32 Network::Session::GetIoIndex() const
+{
+    return ioIndex;
+}
+
+
+void Network::Session::SetIoIndex( Int32 ioIndex )
+{
+    this->ioIndex = ioIndex;
+}
+
+
+Int32 Network::Session::GetIoThreadIndex() const
+{
+    return ioThreadIndex;
+}
+
+
+void Network::Session::SetIoThreadIndex( Int32 ioThreadIndex )
+{
+    this->ioThreadIndex = ioThreadIndex;
+    isIoReleased = ioThreadIndex == NullIoIndex;
+}
+
+
+Bool Network::Session::IsIoReleased() const
+{
+    return isIoReleased;
+}
+
+
+void Network::Session::MarkIoReleased()
+{
+    isIoReleased = true;
+}
+
+
+Network::UdpEndpoint& Network::Session::GetUdpEndpoint()
+{
+    return udpEndpoint;
+}
+
+
+Byte Network::Session::GetProtocolVersion() const
+{
+    return protocolVersion;
+}
+
+
 void Network::Session::SetAddress( const Char* address, UInt16 port )
 {
     addressText = address;
@@ -161,49 +661,278 @@ void Network::Session::SetAddress( const Char* address, UInt16 port )
 void Network::Session::SendByte( const Byte* data, UInt64 size )
 {
     if ( IsClosed() ) return;
-    bool willOver = sendBytes + size > sendBuffer.size();
-    if ( willOver ) sendBuffer.resize( sendBuffer.size() * 2 );
-    memcpy_s( sendBuffer.data() + sendBytes, size, data, size );
-    sendBytes += size;
+    //  ۽   ڿ ̾ ,    ť ֽϴ.
+    UInt32 framedSize = SendFrame::GetFramedSize( static_cast< UInt32 >( size ), protocolVersion );
+    if ( openFrame == nullptr || openFrame->GetRemainBytes() < framedSize )
+    {
+        if ( openFrame == nullptr && server ) server->PostOpenFrame( this );
+        SendFramePool::Release( openFrame );
+        openFrame = SendFramePool::Acquire();
+    }
+    UInt32 begin = openFrame->size;
+    openFrame->AppendPacket( data, static_cast< UInt32 >( size ), protocolVersion );
+    if ( !PushSendEntry( openFrame, begin, openFrame->size ) ) return;
+    if ( !isSendArmed.exchange( true ) && server ) server->PostSendPending( this );
 }
 
 
-void Network::Session::OnReceivedPacketInWaitting( const Packet::Header* data )
+void Network::Session::SendFramedByte( const Byte* data, UInt64 size )
 {
-    if ( data->Type == Packet::EType::ClientRequestFindMatch )
+    // ̹     Ʈ ״ ϴ.
+    if ( IsClosed() ) return;
+    if ( openFrame == nullptr || openFrame->GetRemainBytes() < size )
     {
-        LogInput( "Request Match Find Recv\n" );
-        RequestMatch req;
-        req.requester = this;
-        if ( server ) server->AddRequest( req );
+        if ( openFrame == nullptr && server ) server->PostOpenFrame( this );
+        SendFramePool::Release( openFrame );
+        openFrame = SendFramePool::Acquire();
     }
-    else if( data->Type == Packet::EType::ClientRequestCancelMatch )
+    UInt32 begin = openFrame->size;
+    openFrame->Append( data, static_cast< UInt32 >( size ) );
+    if ( !PushSendEntry( openFrame, begin, openFrame->size ) ) return;
+    if ( !isSendArmed.exchange( true ) && server ) server->PostSendPending( this );
+}
+
+
+void Network::Session::ReleaseOpenFrame()
+{
+    // ƽ   ȣմϴ,  ƽ  ۽  ӿ մϴ.
+    SendFramePool::Release( openFrame );
+    openFrame = nullptr;
+}
+
+
+void Network::Session::SendSharedFrame( SendFrame* frame )
+{
+    // εĳƮ     ť ֽϴ.
+    if ( IsClosed() ) return;
+    if ( !PushSendEntry( frame, 0, frame->size ) ) return;
+    if ( !isSendArmed.exchange( true ) && server ) server->PostSendPending( this );
+}
+
+
+void Network::Session::SendStateByte( const Byte* data, UInt64 size, Int32 stateKey )
+{
+    //      Ŷ,  Ű       ڸ ϴ.
+    // ƽ  FlushStateLane  ۽ ť űϴ, ο    ٷ ť ֽϴ.
+    if ( IsClosed() ) return;
+    if ( size > sizeof( StateLaneSlot::data ) )
+    {
+        SendFramedByte( data, size );
+        return;
+    }
+    if ( !stateLane )
     {
+        stateLane = BufferPool::Acquire( StateLaneSlotSize * StateLaneSlotCount );
+        if ( server ) server->PostStatePending( this );
+    }
+    Packet::EType type = Packet::GetPacketType( data, protocolVersion );
+    StateLaneSlot* slots = reinterpret_cast< StateLaneSlot* >( stateLane );
+    StateLaneSlot* slot = std::find_if( slots,
+                                        slots + stateLaneCount,
+                                        [type, stateKey]( const StateLaneSlot& entry )
+                                        {
+                                            return entry.type == type && entry.key == stateKey;
+                                        }
+                                       );
+    if ( slot != slots + stateLaneCount )
+    {
+        supersededStateCount++;
+    }
+    else if ( stateLaneCount == StateLaneSlotCount )
+    {
+        SendFramedByte( data, size );
+        return;
+    }
+    else
+    {
+        stateLaneCount++;
+    }
+    slot->type = type;
+    slot->key = stateKey;
+    slot->size = static_cast< UInt16 >( size );
+    memcpy( slot->data, data, size );
+}
+
+
+void Network::Session::FlushStateLane()
+{
+    // ƽ   θϴ, Ŭ̾Ʈ з   ʰ  ƽ ·  Ӵϴ.
+    if ( !stateLane ) return;
+    if ( IsClosed() || !UpdateSendBackpressure() )
+    {
+        ReleaseStateLane();
+        return;
+    }
+    if ( queuedSendBytes.load( std::memory_order_acquire ) > static_cast< UInt64 >( Constant::ServerSendBackpressureBytes ) )
+    {
+        heldStateCount++;
+        if ( server ) server->PostStatePending( this );
+        return;
+    }
+    const StateLaneSlot* slots = reinterpret_cast< const StateLaneSlot* >( stateLane );
+    for ( UInt32 i = 0; i < stateLaneCount; i++ )
+    {
+        SendFramedByte( slots[ i ].data, slots[ i ].size );
+    }
+    ReleaseStateLane();
+}
+
+
+Bool Network::Session::IsStatePending( Packet::EType type, Int32 stateKey ) const
+{
+    // ο    SendStateByte   ¸ ϴ.
+    if ( !stateLane ) return false;
+    const StateLaneSlot* slots = reinterpret_cast< const StateLaneSlot* >( stateLane );
+    return std::any_of( slots,
+                        slots + stateLaneCount,
+                        [type, stateKey]( const StateLaneSlot& entry )
+                        {
+                            return entry.type == type && entry.key == stateKey;
+                        }
+                       );
+}
+
+
+UInt64 Network::Session::GetQueuedSendBytes() const
+{
+    return queuedSendBytes.load( std::memory_order_acquire );
+}
+
+
+UInt64 Network::Session::TakeSupersededStateCount()
+{
+    UInt64 count = supersededStateCount;
+    supersededStateCount = 0;
+    return count;
+}
+
+
+UInt64 Network::Session::TakeHeldStateCount()
+{
+    UInt64 count = heldStateCount;
+    heldStateCount = 0;
+    return count;
+}
+
+
+Bool Network::Session::UpdateSendBackpressure()
+{
+    // ۽ ѵ ServerSlowClientTicks ƽ    Ŭ̾Ʈ ϴ,  false Դϴ.
+    if ( queuedSendBytes.load( std::memory_order_acquire ) <= static_cast< UInt64 >( Constant::ServerSendByteLimit ) )
+    {
+        sendOverLimitTick = 0;
+        return true;
+    }
+    UInt64 tick = server ? server->GetTickIndex() : 0;
+    if ( sendOverLimitTick == 0 ) sendOverLimitTick = tick;
+    if ( tick - sendOverLimitTick < static_cast< UInt64 >( Constant::ServerSlowClientTicks ) ) return true;
+    LogInput( "slow client\n" );
+    if ( server ) server->PostSlowClientClosed( this );
+    Close();
+    return false;
+}
+
+
+void Network::Session::ReleaseStateLane()
+{
+    BufferPool::Release( stateLane, StateLaneSlotSize * StateLaneSlotCount );
+    stateLane = nullptr;
+    stateLaneCount = 0;
+}
+
+
+void Network::Session::SendUnreliableByte( const Byte* data, UInt64 size, Int32 stateKey )
+{
+    //     Ʈ ޽ϴ, UDP   ʾ TCP   ϴ.
+    if ( !IsUnreliableBound() )
+    {
+        SendStateByte( data, size, stateKey );
+        return;
+    }
+    Bool wasEmpty = udpEndpoint.payload.empty();
+    udpEndpoint.payload.insert( udpEndpoint.payload.end(), data, data + size );
+    if ( wasEmpty && server ) server->PostUnreliablePending( this );
+}
+
+
+Bool Network::Session::IsUnreliableBound() const
+{
+    return !IsClosed() && udpEndpoint.isBound;
+}
+
+
+void Network::Session::OpenUnreliableChannel()
+{
+    if ( server ) server->IssueUdpToken( this );
+}
+
+
+const Network::PacketDispatcher< Network::Session > Network::Session::waitingDispatcher =
+    PacketDispatcher< Session >()
+    .Register( Packet::EType::ClientHello, &Session::OnHelloReceived )
+    .Register( Packet::EType::ClientRequestFindMatch, &Session::OnFindMatchReceived )
+    .Register( Packet::EType::ClientRequestCancelMatch, &Session::OnCancelMatchReceived )
+    .Register( Packet::EType::ClientRequestReadyMatch, &Session::OnReadyMatchReceived )
+    .Register( Packet::EType::ClientRequestCancelReadyMatch, &Session::OnCancelReadyMatchReceived );
+
+
+void Network::Session::OnReceivedPacketInWaitting( const Packet::Header* data )
+{
+    waitingDispatcher.Dispatch( *this, data );
+}
+
+
+void Network::Session::OnHelloReceived( const Packet::Header* data )
+{
+    //   1     Ŷ ٲߴϴ.
+    const Packet::Client::Hello* hello = reinterpret_cast< const Packet::Client::Hello* >( data );
+    Packet::Server::Hello packet;
+    packet.version = std::min( hello->version, Packet::LatestProtocolVersion );
+    if ( packet.version < Packet::ProtocolVersion1 ) packet.version = Packet::ProtocolVersion1;
+    SendPacket( &packet );
+    protocolVersion = packet.version;
+}
+
+
+void Network::Session::OnFindMatchReceived( const Packet::Header* data )
+{
+    LogInput( "Request Match Find Recv\n" );
+    RequestMatch req;
+    req.requester = handle;
+    if ( server ) server->AddRequest( req );
+}
+
+
+void Network::Session::OnCancelMatchReceived( const Packet::Header* data )
+{
+    LogInput( "Request Match Cancel Recv\n" );
+    if( server )
+    {
+        server->CancelRequest( this );
+        Packet::Server::MatchCanceled packet;
+        SendPacket( &packet );
         LogInput( "Request Match Cancel Recv\n" );
-        if( server )
-        {
-            server->CancelRequest( this );
-            Packet::Server::MatchCanceled packet;
-            SendPacket( &packet );
-            LogInput( "Request Match Cancel Recv\n" );
-        }
     }
-    else if( data->Type == Packet::EType::ClientRequestReadyMatch )
+}
+
+
+void Network::Session::OnReadyMatchReceived( const Packet::Header* data )
+{
+    LogInput( "Request Match Ready Recv\n" );
+    if( server )
     {
-        LogInput( "Request Match Ready Recv\n" );
-        if( server )
-        {
-            server->PostReadyMatch( this );
-        }
+        server->PostReadyMatch( this );
     }
-    else if( data->Type == Packet::EType::ClientRequestCancelReadyMatch )
+}
+
+
+void Network::Session::OnCancelReadyMatchReceived( const Packet::Header* data )
+{
+    LogInput( "Request Match Cancel Ready Recv");
+    std::cout << this << std::endl;
+    if( server )
     {
-        LogInput( "Request Match Cancel Ready Recv");
-        std::cout << this << std::endl;
-        if( server )
-        {
-            server->PostCancelReadyMatch( this );
-        }
+        server->PostCancelReadyMatch( this );
     }
 }
 
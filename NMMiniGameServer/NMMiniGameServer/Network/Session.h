@@ -11,8 +11,15 @@
 
 #pragma once
 #include "Define/DataTypes.h"
+#include "Network/PacketDispatcher.h"
+#include "Network/RingBuffer.h"
+#include "Network/SlotMap.h"
+#include "Network/SendFrame.h"
+#include "Network/UdpChannel.h"
+#include <array>
 #include <vector>
 #include <string>
+#include <atomic>
 #include <stdarg.h>
 
 
@@ -31,6 +38,9 @@ namespace Packet
 
 namespace Network
 {
+    using SessionHandle = SlotHandle;
+    constexpr SessionHandle NullSessionHandle = NullSlotHandle;
+
     class Session
     {
     public:
@@ -43,18 +53,55 @@ namespace Network
             Empty
         };
 
+        static constexpr Int32 NullIoIndex = -1;
+        static constexpr UInt64 ReceiveBufferSize = 4096;
+        static constexpr UInt64 SendQueueSize = 1024; //   
+        static constexpr Int32 MaxGatherCount = 64; // WSASend    WSABUF 
+        static constexpr UInt64 MaxPacketSize = 256; // ޴  ϳ ִ ũ,  1  Header::Size  Byte ̰  2   ũ մϴ
+        static constexpr UInt64 StateLaneSlotSize = 512;
+        static constexpr UInt32 StateLaneSlotCount = 8; //  Ű ٸ  Ŷ Ƶ ĭ 
+
     private:
         SocketHandle socket;
+        SessionHandle handle = NullSessionHandle;
 
-        UInt64 recvBytes = 0;
-        std::vector< Byte > readBuffer;
-
-        UInt64 sendBytes = 0;
-        std::vector< Byte > sendBuffer;
+        RingBuffer readBuffer;
+        SendQueue sendQueue;
+        SendFrame* openFrame = nullptr; //  ۽ Ŷ ̾   , ùķ̼  
+        std::array< Byte, MaxPacketSize > packetScratch; //   Ѿ Ŷ ̴̾ 
 
         std::string id;
         std::string addressText;
         UInt16 port;
+        Int32 ioIndex = NullIoIndex; // I/O   ̺ ε
+        UdpEndpoint udpEndpoint;
+        Byte protocolVersion;
+
+        //  ū Ŷ, ƽ   ä Ӹ ϴ.
+        UInt64 receiveByteTokens = 0;
+        UInt64 receivePacketTokens = 0;
+        UInt64 receiveRefillTick = 0;
+        Bool isReceiveThrottled = false;
+        Bool hasPendingInput = false;
+        Bool hasLatestInput = false;
+        Packet::Client::Input pendingInput; // ѵ  Է  Ű ռ 
+        Packet::Client::Input latestInput; // Ű  , pendingInput  մϴ
+        UInt64 throttledCount = 0; // ̷ų ģ  , 
+
+        // I/O ʹ  , ۽ ť Ʒ ÷׷θ ְ޽ϴ.
+        Int32 ioThreadIndex = NullIoIndex;
+        std::atomic< Bool > isInboundNotified{ false };
+        std::atomic< Bool > isInboundPaused{ false }; //    I/O 尡 б ⸦  
+        std::atomic< Bool > isSendArmed{ false }; // ۽ Ⱑ  ˷
+        std::atomic< Bool > isIoReleased{ true };
+        std::atomic< UInt64 > queuedSendBytes{ 0 }; // ۽ ť ְ    Ʈ
+
+        //   ,  °   BufferPool  ϴ. ùķ̼  Դϴ.
+        Byte* stateLane = nullptr;
+        UInt32 stateLaneCount = 0;
+        UInt64 sendOverLimitTick = 0; // ۽ ѵ ѱ  ƽ, 0 ̸ ѵ 
+        UInt64 supersededStateCount = 0; //    ·  , 
+        UInt64 heldStateCount = 0; // Ŭ̾Ʈ з  ƽ ̷ , 
 
         EState state = EState::Wait;
         Game::PlayerController* contoller = nullptr;
@@ -63,8 +110,13 @@ namespace Network
 
     public:
         Session( SocketHandle socket, class Server* server );
+        ~Session();
+        void Reset( SocketHandle socket );
+        void ReleaseSendFrames();
 
         SocketHandle GetSocket() const;
+        SessionHandle GetHandle() const;
+        void SetHandle( SessionHandle handle );
         Bool HasSendBytes() const;
         const std::string& GetId() const;
         const std::string& GetAddress() const;
@@ -72,10 +124,36 @@ namespace Network
         EState GetState() const;
         Bool IsClosed() const;
         void ClearRoomData();
+        Int32 GetIoIndex() const;
+        void SetIoIndex( Int32 ioIndex );
+        Int32 GetIoThreadIndex() const;
+        void SetIoThreadIndex( Int32 ioThreadIndex );
+        Bool IsIoReleased() const;
+        void MarkIoReleased();
+        UdpEndpoint& GetUdpEndpoint();
+        Byte GetProtocolVersion() const;
     public:
         void SetState( EState state );
         void ProcessSend();
         void ProcessReceive();
+        void OnReceiveCompleted( const Byte* data, UInt64 size );
+        UInt64 GetReceivableBytes() const;
+        UInt64 PeekSendBytes( Byte* destination, UInt64 capacity ) const;
+        void ConsumeSendBytes( UInt64 size );
+        Bool ReceiveInbound();
+        Bool SendOutbound( Bool& hasRemainBytes );
+        Bool MarkInboundNotified();
+        Bool PauseInboundIfFull();
+        void ProcessInbound();
+        void ResumeThrottledReceive();
+        UInt64 TakeThrottledCount();
+        Bool IsReceiveThrottled() const;
+        void FlushStateLane();
+        Bool IsStatePending( Packet::EType type, Int32 stateKey ) const;
+        void ReleaseOpenFrame();
+        UInt64 GetQueuedSendBytes() const;
+        UInt64 TakeSupersededStateCount();
+        UInt64 TakeHeldStateCount();
 
         void Close();
         void SetAddress( const Char* address, UInt16 port );
@@ -83,10 +161,40 @@ namespace Network
         template < class PacketType >
         void SendPacket( const PacketType* buffer );
         void SendByte( const Byte* data, UInt64 size );
+        void SendFramedByte( const Byte* data, UInt64 size );
+        void SendSharedFrame( SendFrame* frame );
+        void SendStateByte( const Byte* data, UInt64 size, Int32 stateKey );
+        void SendUnreliableByte( const Byte* data, UInt64 size, Int32 stateKey );
+        Bool IsUnreliableBound() const;
+        void OpenUnreliableChannel();
         void OnReceivedPacketInWaitting( const Packet::Header* data );
 
         void SetRoom( Game::Room* room );
         void SetController( Game::PlayerController* controller );
+    private:
+        static const PacketDispatcher< Session > waitingDispatcher;
+
+        void OnHelloReceived( const Packet::Header* data );
+        void OnFindMatchReceived( const Packet::Header* data );
+        void OnCancelMatchReceived( const Packet::Header* data );
+        void OnReadyMatchReceived( const Packet::Header* data );
+        void OnCancelReadyMatchReceived( const Packet::Header* data );
+
+        Int32 ReceiveIntoBuffer();
+        void ParseReceivedBytes();
+        Bool ValidateReceivedBytes( UInt64& batchBytes ) const;
+        Bool DispatchReceivedBytes( UInt64 batchBytes );
+        void ResetReceiveTokens();
+        void RefillReceiveTokens();
+        Bool TakeReceiveTokens( UInt64 size );
+        void CoalesceInput( const Packet::Header* data );
+        void MarkReceiveThrottled();
+        void ResumeInboundIfDrained();
+        Bool PushSendEntry( SendFrame* frame, UInt32 begin, UInt32 end );
+        Int32 GatherSendSegments( WSABUF* segments ) const;
+        void PopSentBytes( UInt64 size );
+        Bool UpdateSendBackpressure();
+        void ReleaseStateLane();
     };
     template < class PacketType >
     void Session::SendPacket( const PacketType* buffer )
@@ -0,0 +1,159 @@
+﻿// =================================================================================================
+//  @file SlotMap.h
+// 
+//  @brief 미리 잡아둔 슬롯에 값을 두고 세대 번호가 붙은 32비트 핸들로 찾는 컨테이너입니다.
+//  
+//  @date 2026/10/17
+// 
+//  Copyright 2026 2022 Netmarble Neo, Inc. All Rights Reserved.
+// =================================================================================================
+
+
+#pragma once
+#include "Define/DataTypes.h"
+#include <algorithm>
+#include <memory>
+#include <optional>
+#include <vector>
+
+
+namespace Network
+{
+    // 하위 IndexBits 비트는 슬롯 인덱스, 나머지는 세대입니다. 세대는 1 부터 시작해서 0 은 항상 빈 핸들입니다.
+    using SlotHandle = UInt32;
+    constexpr SlotHandle NullSlotHandle = 0;
+
+    // 슬롯을 비워도 값은 지우지 않고 다음 Acquire 때 다시 씁니다.
+    // 비울 때 세대를 올리므로 지난 핸들은 Get 에서 nullptr 로 걸러집니다.
+    // 살아있는 슬롯 인덱스를 따로 모아두어 순회할 때 빈 슬롯을 건너뜁니다.
+    template< typename T >
+    class SlotMap
+    {
+    public:
+        static constexpr UInt32 IndexBits = 20;
+        static constexpr UInt32 IndexMask = ( 1u << IndexBits ) - 1;
+        static constexpr UInt32 MaxCapacity = IndexMask;
+        static constexpr UInt32 MaxGeneration = ( 1u << ( 32 - IndexBits ) ) - 1;
+
+    private:
+        static constexpr UInt32 NullIndex = 0xFFFFFFFF;
+
+        struct Slot
+        {
+            std::optional< T > value;
+            UInt32 generation = 1;
+            UInt32 aliveIndex = NullIndex; // aliveSlots 안의 위치, NullIndex 면 빈 슬롯
+        };
+
+        std::unique_ptr< Slot[] > slots;
+        UInt32 capacity = 0;
+        std::vector< UInt32 > aliveSlots;
+        std::vector< UInt32 > freeSlots;
+
+    public:
+        class Iterator
+        {
+        private:
+            SlotMap* owner;
+            UInt64 position;
+
+        public:
+            Iterator( SlotMap* owner, UInt64 position ) : owner( owner ), position( position ) {}
+            T& operator*() const { return *owner->slots[ owner->aliveSlots[ position ] ].value; }
+            T* operator->() const { return &**this; }
+            Iterator& operator++() { ++position; return *this; }
+            Bool operator!=( const Iterator& other ) const { return position != other.position; }
+        };
+
+        void Initialize( UInt32 capacity )
+        {
+            this->capacity = std::min( capacity, MaxCapacity );
+            slots = std::make_unique< Slot[] >( this->capacity );
+            aliveSlots.clear();
+            aliveSlots.reserve( this->capacity );
+            freeSlots.clear();
+            freeSlots.reserve( this->capacity );
+            // 앞 슬롯부터 쓰도록 거꾸로 넣습니다.
+            for ( UInt32 i = this->capacity; i > 0; i-- )
+            {
+                freeSlots.push_back( i - 1 );
+            }
+        }
+
+        // 값이 없는 슬롯마다 같은 인자로 미리 만들어 둡니다, 이후 Acquire 한 슬롯은 Get 으로 바로 꺼냅니다.
+        template< typename... Args >
+        void Preallocate( const Args&... args )
+        {
+            for ( UInt32 i = 0; i < capacity; i++ )
+            {
+                if ( !slots[ i ].value ) slots[ i ].value.emplace( args... );
+            }
+        }
+
+        UInt32 GetCapacity() const { return capacity; }
+        UInt64 GetCount() const { return aliveSlots.size(); }
+        Bool IsFull() const { return freeSlots.empty(); }
+
+        // 빈 슬롯을 살리고 핸들을 돌려줍니다, 꽉 차면 NullSlotHandle 입니다.
+        // 처음 쓰는 슬롯이면 Get 이 nullptr 이므로 Emplace 로 값을 만들어야 합니다.
+        SlotHandle Acquire()
+        {
+            if ( freeSlots.empty() ) return NullSlotHandle;
+            UInt32 index = freeSlots.back();
+            freeSlots.pop_back();
+            Slot& slot = slots[ index ];
+            slot.aliveIndex = static_cast< UInt32 >( aliveSlots.size() );
+            aliveSlots.push_back( index );
+            return ( slot.generation << IndexBits ) | index;
+        }
+
+        template< typename... Args >
+        T& Emplace( SlotHandle handle, Args&&... args )
+        {
+            return slots[ handle & IndexMask ].value.emplace( std::forward< Args >( args )... );
+        }
+
+        T* Get( SlotHandle handle )
+        {
+            UInt32 index = handle & IndexMask;
+            if ( handle == NullSlotHandle || index >= capacity ) return nullptr;
+            Slot& slot = slots[ index ];
+            if ( slot.aliveIndex == NullIndex || slot.generation != ( handle >> IndexBits ) || !slot.value ) return nullptr;
+            return &*slot.value;
+        }
+
+        Bool Release( SlotHandle handle )
+        {
+            if ( !Get( handle ) ) return false;
+            ReleaseAt( handle & IndexMask );
+            return true;
+        }
+
+        // 뒤에서부터 지우므로 자리를 바꿔 지워도 아직 보지 않은 슬롯을 건너뛰지 않습니다.
+        template< typename Predicate >
+        void ReleaseIf( Predicate&& predicate )
+        {
+            for ( UInt64 i = aliveSlots.size(); i > 0; i-- )
+            {
+                UInt32 index = aliveSlots[ i - 1 ];
+                if ( predicate( *slots[ index ].value ) ) ReleaseAt( index );
+            }
+        }
+
+        Iterator begin() { return Iterator( this, 0 ); }
+        Iterator end() { return Iterator( this, aliveSlots.size() ); }
+
+    private:
+        void ReleaseAt( UInt32 index )
+        {
+            Slot& slot = slots[ index ];
+            UInt32 lastIndex = aliveSlots.back();
+            aliveSlots[ slot.aliveIndex ] = lastIndex;
+            slots[ lastIndex ].aliveIndex = slot.aliveIndex;
+            aliveSlots.pop_back();
+            slot.aliveIndex = NullIndex;
+            slot.generation = slot.generation == MaxGeneration ? 1 : slot.generation + 1;
+            freeSlots.push_back( index );
+        }
+    };
+};
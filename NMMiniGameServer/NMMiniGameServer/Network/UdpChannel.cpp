@@ -0,0 +1,182 @@
+﻿// =================================================================================================
+//  @file UdpChannel.cpp
+// 
+//  @brief 위치 같은 매 틱 상태를 순서 번호와 함께 보내는 비신뢰 UDP 보조 채널입니다.
+//  
+//  @date 2026/10/17
+// 
+//  Copyright 2026 2022 Netmarble Neo, Inc. All Rights Reserved.
+// =================================================================================================
+
+
+#include "Network/UdpChannel.h"
+#include "Network/Session.h"
+#include "Network/UtillFuntions.h"
+#include "Define/PacketDefine.h"
+#include <cstring>
+#include <iostream>
+
+
+Network::UdpChannel::UdpChannel()
+    : tokenGenerator( std::random_device()() )
+{
+}
+
+
+Network::UdpChannel::~UdpChannel()
+{
+    if ( IsOpened() ) closesocket( socket );
+}
+
+
+void Network::UdpChannel::Initialize( UInt16 port )
+{
+    std::cout << "Open Udp Channel\n";
+    socket = WSASocket( AF_INET, SOCK_DGRAM, IPPROTO_UDP, nullptr, 0, WSA_FLAG_NO_HANDLE_INHERIT );
+    if ( socket == INVALID_SOCKET )
+    {
+        PrintLastErrorMessageInFile( "CreateUdp" );
+        exit( 0 );
+    }
+    SOCKADDR_IN address;
+    ZeroMemory( &address, sizeof( SOCKADDR_IN ) );
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl( INADDR_ANY );
+    address.sin_port = htons( port );
+    if ( bind( socket, ( SOCKADDR* )&address, sizeof( address ) ) == SOCKET_ERROR )
+    {
+        PrintLastErrorMessageInFile( "BindUdp" );
+        exit( 0 );
+    }
+    u_long on = 1;
+    if ( ioctlsocket( socket, FIONBIO, &on ) == SOCKET_ERROR )
+        PrintLastErrorMessageInFile( "ioctlsocket" );
+    datagram.resize( MaxDatagramSize );
+}
+
+
+Bool Network::UdpChannel::IsOpened() const
+{
+    return socket != INVALID_SOCKET;
+}
+
+
+UInt32 Network::UdpChannel::IssueToken( Session* session )
+{
+    Unbind( session );
+    UInt32 token = 0;
+    while ( token == 0 || tokenSessions.count( token ) ) token = tokenGenerator();
+    tokenSessions[ token ] = session;
+    UdpEndpoint& endpoint = session->GetUdpEndpoint();
+    endpoint.token = token;
+    endpoint.isBound = false;
+    endpoint.sequence = 0;
+    endpoint.payload.clear();
+    return token;
+}
+
+
+void Network::UdpChannel::Unbind( Session* session )
+{
+    UdpEndpoint& endpoint = session->GetUdpEndpoint();
+    if ( endpoint.token != 0 ) tokenSessions.erase( endpoint.token );
+    endpoint.token = 0;
+    endpoint.isBound = false;
+    endpoint.payload.clear();
+}
+
+
+void Network::UdpChannel::MarkPending( Session* session )
+{
+    pendingSessions.push_back( session );
+}
+
+
+void Network::UdpChannel::Receive()
+{
+    // recvmmsg 가 없으므로 비어 있을 때까지 한 번씩 받습니다.
+    for ( Int32 i = 0; i < ReceiveBudgetPerTick; i++ )
+    {
+        SOCKADDR_IN from;
+        INT32 fromLength = sizeof( from );
+        Int32 receivedBytes = recvfrom( socket, reinterpret_cast< char* >( datagram.data() ), static_cast< Int32 >( datagram.size() ), 0, ( SOCKADDR* )&from, &fromLength );
+        systemCallCount++;
+        if ( receivedBytes == SOCKET_ERROR )
+        {
+            // ICMP 포트 도달 불가로 생기는 WSAECONNRESET 은 무시합니다.
+            Int32 error = WSAGetLastError();
+            if ( error == WSAEWOULDBLOCK ) return;
+            if ( error != WSAECONNRESET ) PrintLastErrorMessageInFile( "recvfrom" );
+            continue;
+        }
+        if ( receivedBytes < static_cast< Int32 >( sizeof( Packet::Udp::DatagramHeader ) ) ) continue;
+
+        // 클라이언트는 받은 토큰을 담아 보내고, 주소가 바뀌어도 마지막 주소로 다시 묶습니다.
+        const Packet::Udp::DatagramHeader* header = reinterpret_cast< const Packet::Udp::DatagramHeader* >( datagram.data() );
+        auto it = tokenSessions.find( header->token );
+        if ( it == tokenSessions.end() || it->second->IsClosed() ) continue;
+        UdpEndpoint& endpoint = it->second->GetUdpEndpoint();
+        if ( !endpoint.isBound ) it->second->LogInput( "udp bound\n" );
+        endpoint.address = from;
+        endpoint.isBound = true;
+    }
+}
+
+
+void Network::UdpChannel::Flush()
+{
+    for ( Session* session : pendingSessions )
+    {
+        UdpEndpoint& endpoint = session->GetUdpEndpoint();
+        if ( !session->IsClosed() && endpoint.isBound )
+        {
+            // 데이터그램 크기를 넘지 않도록 패킷 경계에서 나눠 보냅니다.
+            const Byte* begin = endpoint.payload.data();
+            const Byte* end = begin + endpoint.payload.size();
+            const Byte* chunkBegin = begin;
+            for ( const Byte* csr = begin; csr != end; )
+            {
+                UInt64 packetSize = Packet::GetPacketSize( csr, session->GetProtocolVersion() );
+                if ( csr != chunkBegin && ( csr - chunkBegin ) + packetSize > MaxDatagramSize - sizeof( Packet::Udp::DatagramHeader ) )
+                {
+                    SendDatagram( session, chunkBegin, csr - chunkBegin );
+                    chunkBegin = csr;
+                }
+                csr += packetSize;
+            }
+            if ( chunkBegin != end ) SendDatagram( session, chunkBegin, end - chunkBegin );
+        }
+        endpoint.payload.clear();
+    }
+    pendingSessions.clear();
+}
+
+
+UInt64 Network::UdpChannel::TakeSystemCallCount()
+{
+    UInt64 count = systemCallCount;
+    systemCallCount = 0;
+    return count;
+}
+
+
+void Network::UdpChannel::SendDatagram( Session* session, const Byte* data, UInt64 size )
+{
+    // sendmmsg 가 없으므로 데이터그램마다 sendto 합니다.
+    UdpEndpoint& endpoint = session->GetUdpEndpoint();
+    Packet::Udp::DatagramHeader header;
+    header.token = endpoint.token;
+    header.sequence = ++endpoint.sequence;
+    memcpy( datagram.data(), &header, sizeof( header ) );
+    memcpy( datagram.data() + sizeof( header ), data, size );
+    Int32 sentBytes = sendto( socket,
+                             reinterpret_cast< const char* >( datagram.data() ),
+                             static_cast< Int32 >( sizeof( header ) + size ),
+                             0,
+                             ( const SOCKADDR* )&endpoint.address,
+                             sizeof( endpoint.address )
+                            );
+    systemCallCount++;
+    // 비신뢰 채널이므로 보내지 못한 데이터그램은 버립니다.
+    if ( sentBytes == SOCKET_ERROR && WSAGetLastError() != WSAEWOULDBLOCK ) PrintLastErrorMessageInFile( "sendto" );
+}
@@ -0,0 +1,62 @@
+﻿// =================================================================================================
+//  @file UdpChannel.h
+// 
+//  @brief 위치 같은 매 틱 상태를 순서 번호와 함께 보내는 비신뢰 UDP 보조 채널입니다.
+//  
+//  @date 2026/10/17
+// 
+//  Copyright 2026 2022 Netmarble Neo, Inc. All Rights Reserved.
+// =================================================================================================
+
+
+#pragma once
+#include "Define/DataTypes.h"
+#include <WinSock2.h>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+
+namespace Network
+{
+    class Session;
+
+    // 세션별 UDP 상대 정보, 토큰으로 TCP 세션과 묶입니다.
+    struct UdpEndpoint
+    {
+        UInt32 token = 0;
+        Bool isBound = false;
+        SOCKADDR_IN address;
+        UInt32 sequence = 0;
+        std::vector< Byte > payload; // 이번 틱에 보낼 패킷들
+    };
+
+    class UdpChannel
+    {
+    public:
+        static constexpr UInt64 MaxDatagramSize = 1200; // 단편화되지 않을 크기
+        static constexpr Int32 ReceiveBudgetPerTick = 256;
+
+    private:
+        SocketHandle socket = INVALID_SOCKET;
+        std::mt19937 tokenGenerator;
+        std::unordered_map< UInt32, Session* > tokenSessions;
+        std::vector< Session* > pendingSessions;
+        std::vector< Byte > datagram;
+        UInt64 systemCallCount = 0;
+
+    public:
+        UdpChannel();
+        ~UdpChannel();
+        void Initialize( UInt16 port );
+        Bool IsOpened() const;
+        UInt32 IssueToken( Session* session );
+        void Unbind( Session* session );
+        void MarkPending( Session* session );
+        void Receive();
+        void Flush();
+        UInt64 TakeSystemCallCount();
+    private:
+        void SendDatagram( Session* session, const Byte* data, UInt64 size );
+    };
+};